@@ -16,56 +16,57 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <fr/ImguiWidgets.h>
 
 namespace fr::Imgui {
 
-  class ActorWindow : public NodeWindow {
+  class ActorWindow : public TypedNodeWindow<fr::RequirementsManager::Actor> {
   protected:
     static const size_t actorLen = 201;
     char _actor[actorLen];
-    std::string _actorLabel;
+    const char *_actorLabel;
 
   public:
     using Type = ActorWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Actor>;
     using NodeType = fr::RequirementsManager::Actor;
 
     ActorWindow(const std::string &title = "Actor") : Parent(title) {
       memset(_actor, '\0', actorLen);
-      _actorLabel = getUniqueLabel("##Actor");
+      _actorLabel = "##Actor";
     }
 
     virtual ~ActorWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_actor, node->getActor().c_str(), actorLen - 1);
       }
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_actor);
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
 
         ImGui::Text("Actor: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_actorLabel.c_str(),
+        if (ImGui::InputText(_actorLabel,
                              _actor,
                              actorLen - 1,
                              inputTextFlags)) {
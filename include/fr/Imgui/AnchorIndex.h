@@ -0,0 +1,85 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <imgui.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace fr::Imgui {
+
+  class NodeAnchor;
+
+  /**
+   * Uniform grid of anchor centers in screen coordinates. Anchors move
+   * themselves in it from setCenter, which only happens when their
+   * window moves. Once a frame the editor asks it which anchors are
+   * under the mouse and only those submit ImGui items (the hover
+   * button, drag source and drop target). Everything else just draws
+   * its circle.
+   *
+   * UI thread only, like the rest of the rendering.
+   */
+
+  class AnchorIndex {
+    struct Entry {
+      NodeAnchor *anchor;
+      // Index entries don't keep anchors alive. Dead ones get dropped
+      // when a lookup runs into them.
+      std::weak_ptr<NodeAnchor> ref;
+    };
+
+    // Cells are a good deal bigger than an anchor so a lookup only
+    // ever has to look at a handful of them
+    static constexpr float cellSize = 64.0f;
+
+    std::unordered_map<uint64_t, std::vector<Entry>> _cells;
+    size_t _size;
+
+    static uint64_t cellKey(int32_t x, int32_t y) {
+      return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    static int32_t cellCoordinate(float value);
+
+    void erase(NodeAnchor *anchor, uint64_t key);
+
+  public:
+    AnchorIndex() : _size(0) {}
+
+    AnchorIndex(const AnchorIndex &) = delete;
+    AnchorIndex &operator=(const AnchorIndex &) = delete;
+
+    // Put an anchor in the index at center
+    void insert(std::shared_ptr<NodeAnchor> anchor, ImVec2 center);
+    // Move an anchor from one center to another
+    void move(std::shared_ptr<NodeAnchor> anchor, ImVec2 from, ImVec2 to);
+    // Take an anchor out of the index
+    void remove(NodeAnchor *anchor, ImVec2 center);
+
+    size_t size() const {
+      return _size;
+    }
+
+    // Marks every anchor within radius of point as hot for frame, so
+    // it submits its ImGui items this frame
+    void markHot(ImVec2 point, float radius, int frame);
+  };
+
+}
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <imgui.h>
+
+namespace fr::Imgui {
+
+  /**
+   * How much of a node window to draw at the current zoom.
+   * Box is a colored rectangle with the title, Summary is a
+   * read-only window with a line or two about the node, and
+   * Full is the regular window with all its editable widgets.
+   */
+
+  enum class DetailLevel {
+    Box,
+    Summary,
+    Full
+  };
+
+  /**
+   * Pan and zoom transform for the editor. Node windows keep their
+   * position and size in canvas coordinates and convert to screen
+   * coordinates through this. At zoom 1 with no pan the two are the
+   * same, so windows end up where ImGui first put them.
+   *
+   * Anything that caches screen positions can compare version()
+   * against what it saw last to find out the canvas changed.
+   */
+
+  class Canvas {
+    // Screen position of the canvas origin
+    ImVec2 _pan;
+    float _zoom;
+    float _minZoom;
+    float _maxZoom;
+    // Below this zoom nodes draw as boxes
+    float _boxZoom;
+    // Below this zoom (and above _boxZoom) nodes draw as summaries
+    float _summaryZoom;
+    // Bumped every time the pan or zoom changes
+    uint64_t _version;
+
+  public:
+    Canvas() : _pan(0.0f, 0.0f), _zoom(1.0f), _minZoom(0.05f), _maxZoom(2.0f),
+               _boxZoom(0.35f), _summaryZoom(0.7f), _version(1) {
+    }
+
+    ImVec2 toScreen(ImVec2 canvas) const {
+      return ImVec2(canvas.x * _zoom + _pan.x, canvas.y * _zoom + _pan.y);
+    }
+
+    ImVec2 toCanvas(ImVec2 screen) const {
+      return ImVec2((screen.x - _pan.x) / _zoom, (screen.y - _pan.y) / _zoom);
+    }
+
+    // Scale a canvas size to a screen size
+    ImVec2 scale(ImVec2 size) const {
+      return ImVec2(size.x * _zoom, size.y * _zoom);
+    }
+
+    // Scale a screen size back to a canvas size
+    ImVec2 unscale(ImVec2 size) const {
+      return ImVec2(size.x / _zoom, size.y / _zoom);
+    }
+
+    float zoom() const {
+      return _zoom;
+    }
+
+    ImVec2 pan() const {
+      return _pan;
+    }
+
+    uint64_t version() const {
+      return _version;
+    }
+
+    DetailLevel detailLevel() const {
+      if (_zoom < _boxZoom) {
+        return DetailLevel::Box;
+      }
+      if (_zoom < _summaryZoom) {
+        return DetailLevel::Summary;
+      }
+      return DetailLevel::Full;
+    }
+
+    // Move the canvas by delta screen pixels
+    void panBy(ImVec2 delta) {
+      if (delta.x == 0.0f && delta.y == 0.0f) {
+        return;
+      }
+      _pan.x += delta.x;
+      _pan.y += delta.y;
+      ++_version;
+    }
+
+    // Multiply the zoom by factor, keeping the canvas point under
+    // the screen point where it is. Use the mouse position to zoom
+    // toward the cursor.
+    void zoomAt(ImVec2 screen, float factor) {
+      float zoom = std::clamp(_zoom * factor, _minZoom, _maxZoom);
+      if (zoom == _zoom) {
+        return;
+      }
+      ImVec2 anchor = toCanvas(screen);
+      _zoom = zoom;
+      _pan.x = screen.x - anchor.x * _zoom;
+      _pan.y = screen.y - anchor.y * _zoom;
+      ++_version;
+    }
+
+    void setZoom(float zoom) {
+      zoomAt(_pan, zoom / _zoom);
+    }
+
+    // Back to zoom 1 with no pan
+    void reset() {
+      _pan = ImVec2(0.0f, 0.0f);
+      _zoom = 1.0f;
+      ++_version;
+    }
+
+    void setZoomLimits(float minZoom, float maxZoom) {
+      _minZoom = minZoom;
+      _maxZoom = maxZoom;
+      setZoom(std::clamp(_zoom, _minZoom, _maxZoom));
+    }
+
+    // Zoom levels where nodes switch to boxes and to summaries
+    void setDetailThresholds(float boxZoom, float summaryZoom) {
+      _boxZoom = boxZoom;
+      _summaryZoom = summaryZoom;
+      ++_version;
+    }
+  };
+
+}
@@ -17,7 +17,7 @@
 #pragma once
 
 #include <fteng/signals.hpp>
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <format>
 
 namespace fr::Imgui {
@@ -27,12 +27,11 @@ namespace fr::Imgui {
    * nodes in addition to the up/down ones.
    */
 
-  class CommitableNodeWindow : public NodeWindow {
-    std::vector<fteng::connection> _subscriptions;
+  class CommitableNodeWindow : public TypedNodeWindow<fr::RequirementsManager::CommitableNode> {
   public:
     using Type = CommitableNodeWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::CommitableNode>;
     using NodeType = fr::RequirementsManager::CommitableNode;
 
     static constexpr char WindowTitle[] = "CommitableNode";
@@ -44,8 +43,8 @@ namespace fr::Imgui {
       Parent(label) {
       ImU32 white = IM_COL32(255,255,255,255);
       ImU32 red = IM_COL32(255,0,0,255);
-      _leftAnchor = std::make_shared<NodeAnchor>("##LeftAnchor", ImVec2(0,0), 5.0, white, red, AnchorType::Left);
-      _rightAnchor = std::make_shared<NodeAnchor>("##RightAnchor", ImVec2(0,0), 5.0, white, red, AnchorType::Right);
+      _leftAnchor = makeArenaShared<NodeAnchor>("##LeftAnchor", ImVec2(0,0), 5.0, white, red, AnchorType::Left);
+      _rightAnchor = makeArenaShared<NodeAnchor>("##RightAnchor", ImVec2(0,0), 5.0, white, red, AnchorType::Right);
     }
 
     virtual ~CommitableNodeWindow() {}
@@ -54,39 +53,47 @@ namespace fr::Imgui {
 
       this->addWidget(_leftAnchor->getLabel(), _leftAnchor);
       this->addWidget(_rightAnchor->getLabel(), _rightAnchor);
-
-      auto sub = this->moved.connect([&](Window::PtrType parent,
-                                         const ImVec2& pos) {
-        _min = pos;
-
-        // Put the left/right anchor nodes at the top of the window
-        // and see how that looks
-        ImVec2 leftAnchor(10.0, 25.0);
-        _leftAnchor->setCenter(screenCoordinate(leftAnchor));
-        ImVec2 rightAnchor(_currentSize.x, 25.0);
-        _rightAnchor->setCenter(screenCoordinate(rightAnchor));
-      });
-      _subscriptions.push_back(std::move(sub));
       Parent::init();
     }
 
+    void positionAnchors(ImVec2 contentSize) override {
+      Parent::positionAnchors(contentSize);
+      // Put the left/right anchor nodes at the top of the window
+      // and see how that looks
+      ImVec2 leftAnchor(10.0, 25.0);
+      _leftAnchor->setCenter(screenCoordinate(leftAnchor));
+      ImVec2 rightAnchor(contentSize.x, 25.0);
+      _rightAnchor->setCenter(screenCoordinate(rightAnchor));
+    }
+
+    void drawConnections() override {
+      Parent::drawConnections();
+      _leftAnchor->drawConnections();
+      _rightAnchor->drawConnections();
+    }
+
+    void close() override {
+      _leftAnchor->disconnectAll();
+      _rightAnchor->disconnectAll();
+      Parent::close();
+    }
+
     void begin() override {
       Parent::begin();
       
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::CommitableNode>(_node);
+      auto node = _typedNode;
       if (node) {
         if (node->isCommitted()) {
           _displayEditable = false;
           _editable = false;          
         }
-        if (!node->isCommitted()) {
+        if (!node->isCommitted() && !frozen()) {
           if (ImGui::Button("Commit")) {
             node->commit();
           }
           if (ImGui::IsItemHovered()) {
             ImGui::BeginTooltip();
-            std::string tooltipText = std::format("Committing the node causes it to become permanently un-editable.");
-            ImGui::Text(tooltipText.c_str());
+            ImGui::TextUnformatted("Committing the node causes it to become permanently un-editable.");
             ImGui::EndTooltip();
           }
         }
@@ -16,36 +16,33 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class CompletedWindow : public NodeWindow {
+  class CompletedWindow : public TypedNodeWindow<fr::RequirementsManager::Completed> {
   protected:
     std::string _description;
-    std::string _descriptionLabel;
+    const char *_descriptionLabel;
 
   public:
     using Type = CompletedWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Completed>;
     using NodeType = fr::RequirementsManager::Completed;
 
     CompletedWindow(const std::string &title = "Completed") : Parent(title) {
-      _descriptionLabel = getUniqueLabel("##Description");
+      _descriptionLabel = "##Description";
     }
 
     virtual ~CompletedWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
+      ensureNode();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         _description = node->getDescription();
       }
@@ -53,17 +50,21 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_description);
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Description:");
-        if (ImGui::InputTextMultiline(_descriptionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_descriptionLabel,
                                       &_description,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <imgui.h>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fr::Imgui {
+
+  class Canvas;
+  class NodeAnchor;
+
+  /**
+   * Every link between node windows in an editor, held once. Anchors
+   * still keep their own connection lists for linking and unlinking,
+   * but they register each edge here and the editor draws them all in
+   * one pass at the end of the frame. Edges that can't be on screen
+   * are skipped and the number of curve segments follows the curve's
+   * length on screen. Curves bend out as far as the canvas is zoomed,
+   * so zoomed out nodes don't get edges looping far past them.
+   *
+   * Edges are always stored from the Down or Right anchor to the Up
+   * or Left one, so it doesn't matter which end registers it.
+   *
+   * Anchors get linked and unlinked on the UI thread (WindowFactory
+   * connects in materialize) so there's no locking here.
+   */
+
+  class EdgeStore {
+    struct Edge {
+      NodeAnchor *from;
+      NodeAnchor *to;
+      // Anchors go away with their windows. These let draw notice
+      // without holding the windows alive.
+      std::weak_ptr<NodeAnchor> fromRef;
+      std::weak_ptr<NodeAnchor> toRef;
+      ImU32 color;
+    };
+
+    using Key = std::pair<const NodeAnchor *, const NodeAnchor *>;
+
+    struct KeyHash {
+      size_t operator()(const Key &key) const {
+        size_t first = std::hash<const NodeAnchor *>{}(key.first);
+        size_t second = std::hash<const NodeAnchor *>{}(key.second);
+        return first ^ (second + 0x9e3779b97f4a7c15ull + (first << 6) + (first >> 2));
+      }
+    };
+
+    std::vector<Edge> _edges;
+    // Position of each edge in _edges
+    std::unordered_map<Key, size_t, KeyHash> _index;
+    // Canvas the anchors sit on, for the zoom. Can be null.
+    const Canvas *_canvas;
+
+    // Curve shape and tessellation
+    static constexpr float thickness = 2.0f;
+    static constexpr float pixelsPerSegment = 24.0f;
+    static constexpr int minSegments = 2;
+    static constexpr int maxSegments = 32;
+
+    // Puts the anchors in from/to order
+    static std::pair<NodeAnchor *, NodeAnchor *> orient(NodeAnchor *a, NodeAnchor *b);
+    void eraseAt(size_t position);
+    // Drops edges whose anchors have been destroyed
+    void prune();
+
+  public:
+    // How far an edge's control points sit from its ends at zoom 1.
+    // NodeAnchor's drag preview uses it too.
+    static constexpr float controlOffset = 50.0f;
+
+    EdgeStore() : _canvas(nullptr) {}
+
+    EdgeStore(const EdgeStore &) = delete;
+    EdgeStore &operator=(const EdgeStore &) = delete;
+
+    // Record an edge between two anchors. Does nothing if it's
+    // already there. The edge takes the link color of its from
+    // anchor, so it's the same whichever end connected first.
+    void add(std::shared_ptr<NodeAnchor> a, std::shared_ptr<NodeAnchor> b);
+    // Forget the edge between two anchors, if there is one
+    void remove(NodeAnchor *a, NodeAnchor *b);
+    bool contains(NodeAnchor *a, NodeAnchor *b) const;
+
+    size_t size() const {
+      return _edges.size();
+    }
+
+    void setCanvas(const Canvas *canvas) {
+      _canvas = canvas;
+    }
+
+    // Draw every edge that could be on screen to the foreground
+    // draw list. Call once a frame after the node windows render,
+    // so the anchors are where their windows are this frame.
+    void draw();
+  };
+
+}
@@ -16,40 +16,38 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class EffortWindow : public NodeWindow {
+  class EffortWindow : public TypedNodeWindow<fr::RequirementsManager::Effort> {
   protected:
     std::string _text;
-    std::string _textLabel;
+    const char *_textLabel;
     // We'll convert effort from hours
     int _effort;
-    std::string _effortLabel;
+    const char *_effortLabel;
 
   public:
     using Type = EffortWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Effort>;
     using NodeType = fr::RequirementsManager::Effort;
 
     EffortWindow(const std::string &title = "Effort") : Parent(title) {
-      _textLabel = getUniqueLabel("##Text");
-      _effortLabel = getUniqueLabel("##Effort");
+      _textLabel = "##Text";
+      _effortLabel = "##Effort";
       _effort = 0;
     }
 
     virtual ~EffortWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         _text = node->getText();
         // 3600 seconds in an hour
@@ -59,19 +57,23 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("Effort {}: {}", _effort, _text));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }        
       
         ImGui::Text("Effort (hours):");
         ImGui::SameLine();
-        if (ImGui::InputInt(_effortLabel.c_str(),
+        if (ImGui::InputInt(_effortLabel,
                             &_effort,
                             1,
                             5,
@@ -81,7 +83,7 @@ namespace fr::Imgui {
         }
         
         ImGui::Text("Text:");
-        if (ImGui::InputTextMultiline(_textLabel.c_str(),
+        if (ImGui::InputTextMultiline(_textLabel,
                                       &_text,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -16,53 +16,54 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 
 namespace fr::Imgui {
 
-  class EmailAddressWindow : public NodeWindow {
+  class EmailAddressWindow : public TypedNodeWindow<fr::RequirementsManager::EmailAddress> {
     static const size_t addressLen = 201;
     char _address[addressLen];
-    std::string _addressLabel;
+    const char *_addressLabel;
     
   public:
     using Type = EmailAddressWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::EmailAddress>;
     using NodeType = fr::RequirementsManager::EmailAddress;
 
     EmailAddressWindow(const std::string &title = "Email Address") : Parent(title) {
       memset(_address, '\0', addressLen);
-      _addressLabel = getUniqueLabel("##Address");
+      _addressLabel = "##Address";
     }
 
     virtual ~EmailAddressWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_address, node->getAddress().c_str(), addressLen - 1);
       }
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_address);
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Email Address: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_addressLabel.c_str(),
+        if (ImGui::InputText(_addressLabel,
                              _address,
                              addressLen - 1,
                              inputTextFlags)) {
@@ -16,39 +16,37 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class EventWindow : public NodeWindow {
+  class EventWindow : public TypedNodeWindow<fr::RequirementsManager::Event> {
     static const size_t nameLen = 201;
     char _name[nameLen];
-    std::string _nameLabel;
+    const char *_nameLabel;
     std::string _description;
-    std::string _descriptionLabel;
+    const char *_descriptionLabel;
 
   public:
     using Type = EventWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Event>;
     using NodeType = fr::RequirementsManager::Event;
 
     EventWindow(const std::string &title = "Event") : Parent(title) {
       memset(_name, '\0', nameLen);
-      _nameLabel = getUniqueLabel("##Name");
-      _descriptionLabel = getUniqueLabel("##Description");
+      _nameLabel = "##Name";
+      _descriptionLabel = "##Description";
     }
 
     virtual ~EventWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_name, node->getName().c_str(), nameLen - 1);
         _description = node->getDescription();
@@ -56,25 +54,29 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{}", _name, _description));
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Event Name: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_nameLabel.c_str(),
+        if (ImGui::InputText(_nameLabel,
                              _name,
                              nameLen - 1,
                              inputTextFlags)) {
           node->setName(_name);
         }
         ImGui::Text("Event Description:");
-        if (ImGui::InputTextMultiline(_descriptionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_descriptionLabel,
                                       &_description,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
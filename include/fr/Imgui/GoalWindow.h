@@ -24,55 +24,53 @@
 #include <chrono>
 #include <ctime>
 #include <format>
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 #include <time.h>
 
 namespace fr::Imgui {
 
-  class GoalWindow : public NodeWindow {
+  class GoalWindow : public TypedNodeWindow<fr::RequirementsManager::Goal> {
     static const size_t confidenceLen = 201;
     char _confidence[confidenceLen];
-    std::string _confidenceLabel;
-    std::string _actionLabel;
+    const char *_confidenceLabel;
+    const char *_actionLabel;
     std::string _action;
-    std::string _outcomeLabel;
+    const char *_outcomeLabel;
     std::string _outcome;
-    std::string _contextLabel;
+    const char *_contextLabel;
     std::string _context;
-    std::string _targetDateLabel;
+    const char *_targetDateLabel;
     time_t _targetDate;
-    std::string _alignmentLabel;
+    const char *_alignmentLabel;
     std::string _alignment;
     tm _tmNow;
+    static const size_t dateTextLen = 32;
+    char _targetDateText[dateTextLen];
 
   public:
     using Type = GoalWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Goal>;
     using NodeType = fr::RequirementsManager::Goal;
 
     GoalWindow(const std::string &title = "Goal") : Parent(title) {
       memset(_confidence, '\0', confidenceLen);
-      _confidenceLabel = getUniqueLabel("##Confidence");
-      _actionLabel = getUniqueLabel("##Action");
-      _outcomeLabel = getUniqueLabel("##Outcome");
-      _contextLabel = getUniqueLabel("##Context");
-      _targetDateLabel = getUniqueLabel("##TargetDate");
-      _alignmentLabel = getUniqueLabel("##Alignment");
+      memset(_targetDateText, '\0', dateTextLen);
+      _confidenceLabel = "##Confidence";
+      _actionLabel = "##Action";
+      _outcomeLabel = "##Outcome";
+      _contextLabel = "##Context";
+      _targetDateLabel = "##TargetDate";
+      _alignmentLabel = "##Alignment";
     }
 
     virtual ~GoalWindow() {}
 
     void init() override {
-      bool inittedNode = false;
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-        inittedNode = true;
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      bool inittedNode = ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_confidence, node->getTargetDateConfidence().c_str(), confidenceLen - 1);
         _action = node->getAction();
@@ -90,42 +88,47 @@ namespace fr::Imgui {
           now = _targetDate;
         }
         _tmNow = *std::gmtime(&now);
+        std::strftime(_targetDateText, dateTextLen, "%F", &_tmNow);
       }
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\nTarget: {}", _action, _targetDateText));
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
 
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Action:");
-        if (ImGui::InputTextMultiline(_actionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_actionLabel,
                                       &_action,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
           node->setAction(_action);          
         }
         ImGui::Text("Outcome:");
-        if (ImGui::InputTextMultiline(_outcomeLabel.c_str(),
+        if (ImGui::InputTextMultiline(_outcomeLabel,
                                       &_outcome,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
           node->setOutcome(_outcome);
         }
         ImGui::Text("Context:");
-        if (ImGui::InputTextMultiline(_contextLabel.c_str(),
+        if (ImGui::InputTextMultiline(_contextLabel,
                                       &_context,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
           node->setContext(_context);
         }
         ImGui::Text("Alignment:");
-        if (ImGui::InputTextMultiline(_alignmentLabel.c_str(),
+        if (ImGui::InputTextMultiline(_alignmentLabel,
                                       &_alignment,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -133,15 +136,21 @@ namespace fr::Imgui {
 
         }
         ImGui::Text("Target Date:");
-        if (ImGui::DatePicker(_targetDateLabel.c_str(), _tmNow)) {
-          auto estimate = std::mktime(&_tmNow);
-          // This is an actual date in the POSIX epoch, we're not
-          // deltaing this from when it's started.
-          node->setTargetDate(estimate);
+        if (editable()) {
+          if (ImGui::DatePicker(_targetDateLabel, _tmNow)) {
+            auto estimate = std::mktime(&_tmNow);
+            // This is an actual date in the POSIX epoch, we're not
+            // deltaing this from when it's started.
+            node->setTargetDate(estimate);
+            std::strftime(_targetDateText, dateTextLen, "%F", &_tmNow);
+          }
+        } else {
+          ImGui::SameLine();
+          ImGui::TextUnformatted(_targetDateText);
         }
         ImGui::Text("Target Date Confidence: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_confidenceLabel.c_str(),
+        if (ImGui::InputText(_confidenceLabel,
                              _confidence,
                              confidenceLen - 1,
                              inputTextFlags)) {
@@ -0,0 +1,152 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace fr::Imgui {
+
+  /**
+   * Memory for the windows, anchors and link payloads of one loaded
+   * graph. WindowFactory makes one per graph it's given and creates
+   * that graph's objects in it, so they sit next to each other
+   * instead of all over the heap. Nothing in the arena gets freed on
+   * its own. It all goes back in one step when the last object made
+   * from it is gone.
+   *
+   * Objects keep the arena alive through their allocator (see
+   * ArenaAllocator), so it can't go away before they do.
+   *
+   * Not thread safe. Make things in it from one thread at a time
+   * (WindowFactory does it from materialize, on the UI thread).
+   */
+
+  class GraphArena {
+    std::pmr::monotonic_buffer_resource _resource;
+    size_t _bytes;
+
+    // Arena ArenaScope set on this thread, if any
+    static thread_local std::shared_ptr<GraphArena> _current;
+
+    friend class ArenaScope;
+
+  public:
+    using PtrType = std::shared_ptr<GraphArena>;
+
+    // initialSize is a guess at how much the graph will need. The
+    // arena grows past it if it's wrong.
+    explicit GraphArena(size_t initialSize) : _resource(initialSize), _bytes(0) {
+    }
+
+    GraphArena(const GraphArena &) = delete;
+    GraphArena &operator=(const GraphArena &) = delete;
+
+    void *allocate(size_t bytes, size_t alignment) {
+      _bytes += bytes;
+      return _resource.allocate(bytes, alignment);
+    }
+
+    // Memory comes back when the arena goes away
+    void deallocate(void *, size_t, size_t) {
+    }
+
+    // Bytes handed out so far
+    size_t bytes() const {
+      return _bytes;
+    }
+
+    // Arena of the innermost ArenaScope on this thread. Null
+    // outside of one.
+    static const PtrType &current() {
+      return _current;
+    }
+  };
+
+  /**
+   * Standard allocator over a GraphArena, for allocate_shared. Holds
+   * a reference to the arena, so a shared_ptr's control block keeps
+   * the arena around until the object is destroyed and deallocated.
+   */
+
+  template <typename T>
+  class ArenaAllocator {
+    template <typename U>
+    friend class ArenaAllocator;
+
+    GraphArena::PtrType _arena;
+
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(GraphArena::PtrType arena) : _arena(std::move(arena)) {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : _arena(other._arena) {
+    }
+
+    T *allocate(size_t count) {
+      return static_cast<T *>(_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *pointer, size_t count) {
+      _arena->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const {
+      return _arena == other._arena;
+    }
+  };
+
+  /**
+   * Makes GraphArena::current() return arena until it goes out of
+   * scope. Put one around creating a graph's windows and everything
+   * they make with makeArenaShared ends up in the arena.
+   */
+
+  class ArenaScope {
+    GraphArena::PtrType _previous;
+
+  public:
+    explicit ArenaScope(GraphArena::PtrType arena) : _previous(std::move(GraphArena::_current)) {
+      GraphArena::_current = std::move(arena);
+    }
+
+    ~ArenaScope() {
+      GraphArena::_current = std::move(_previous);
+    }
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+  };
+
+  // std::make_shared, but in the current ArenaScope's arena if there
+  // is one
+  template <typename T, typename... Args>
+  std::shared_ptr<T> makeArenaShared(Args &&...args) {
+    const GraphArena::PtrType &arena = GraphArena::current();
+    if (arena) {
+      return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// cereal only binds polymorphic node types to archives it's seen by
+// the time the node headers register them, so these go first
+#include <cereal/archives/json.hpp>
+#include <cereal/archives/portable_binary.hpp>
+#include <fr/Imgui/GraphLoad.h>
+#include <fr/RequirementsManager/Node.h>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace fr::Imgui {
+
+  // What's in a graph file. Json is the old format, Binary is cereal's
+  // portable binary archive, which is smaller and much quicker to read.
+  enum class GraphFormat {
+    Json,
+    Binary
+  };
+
+  constexpr std::string_view jsonGraphExtension = ".json";
+  constexpr std::string_view binaryGraphExtension = ".frg";
+
+  // Filter string for ImGuiFileDialog. The dialog offers each one
+  // separately.
+  constexpr const char *graphFileFilters = ".json,.frg";
+
+  // Format of the file at path, going by its extension. Anything
+  // that isn't .frg is read as JSON.
+  GraphFormat graphFormatFor(const std::string &path);
+
+  // Read a graph from in. Throws whatever cereal throws if the input
+  // isn't a graph in that format.
+  inline fr::RequirementsManager::Node::PtrType readGraph(std::istream &in, GraphFormat format) {
+    fr::RequirementsManager::Node::PtrType root;
+    if (format == GraphFormat::Binary) {
+      cereal::PortableBinaryInputArchive archive(in);
+      archive(root);
+    } else {
+      cereal::JSONInputArchive archive(in);
+      archive(root);
+    }
+    return root;
+  }
+
+  // Write a graph to out. The archive is finished when this returns.
+  // Binary needs out opened with std::ios::binary.
+  inline void writeGraph(std::ostream &out, const fr::RequirementsManager::Node::PtrType &root,
+                         GraphFormat format) {
+    if (format == GraphFormat::Binary) {
+      cereal::PortableBinaryOutputArchive archive(out);
+      archive(root);
+    } else {
+      cereal::JSONOutputArchive archive(out);
+      archive(root);
+    }
+  }
+
+  /**
+   * A whole file mapped read only. Reading it doesn't copy anything
+   * into a buffer, the pages come straight from the page cache.
+   * Platforms without mmap read the file into memory instead.
+   */
+
+  class MappedFile {
+    const char *_data;
+    size_t _size;
+    bool _open;
+    // Set if _data came from new[] rather than mmap
+    bool _owned;
+    std::string _error;
+
+  public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool is_open() const {
+      return _open;
+    }
+
+    const char *data() const {
+      return _data;
+    }
+
+    size_t size() const {
+      return _size;
+    }
+
+    // Why the file couldn't be mapped. Empty if it was.
+    const std::string &error() const {
+      return _error;
+    }
+  };
+
+  /**
+   * Hands a MappedFile to a stream without copying it. The get area
+   * points into the mapping, a chunk at a time so a GraphLoad can
+   * count progress and stop handing out bytes once it's cancelled,
+   * like GraphLoadStreambuf does. load can be null for reads that
+   * aren't part of one.
+   */
+
+  class MappedGraphStreambuf : public std::streambuf {
+    MappedFile _file;
+    GraphLoad *_load;
+    size_t _offset;
+
+  public:
+    static constexpr size_t chunkSize = 1024 * 1024;
+
+    explicit MappedGraphStreambuf(const std::string &path, GraphLoad *load = nullptr);
+
+    bool is_open() const {
+      return _file.is_open();
+    }
+
+    const std::string &error() const {
+      return _file.error();
+    }
+
+  protected:
+    int_type underflow() override;
+  };
+
+}
@@ -0,0 +1,491 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <deque>
+#include <format>
+#include <fr/ImguiWidgets.h>
+#include <fr/RequirementsManager.h>
+#include <fr/types/Concepts.h>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fr::Imgui {
+
+  /**
+   * How the generator picks the size of long text fields
+   */
+
+  enum class TextSizeDistribution {
+    // Every long field is textSizeMax bytes
+    Fixed,
+    // Evenly spread between textSizeMin and textSizeMax
+    Uniform,
+    // Spread evenly over the log of the size, so most fields are
+    // small and a few are huge. Closest to what real graphs look like.
+    LogUniform
+  };
+
+  struct GraphGeneratorOptions {
+    // Same seed, same graph
+    uint64_t seed = 1;
+    // Total nodes including the root GraphNode and change chain versions
+    size_t nodeCount = 1000;
+    // Each node gets between 1 and fanOut down nodes
+    size_t fanOut = 4;
+    // Deepest level below the root. 0 means no limit.
+    size_t maxDepth = 0;
+    // Size in bytes of long text fields (descriptions, text, etc.)
+    size_t textSizeMin = 16;
+    size_t textSizeMax = 256;
+    TextSizeDistribution textDistribution = TextSizeDistribution::Uniform;
+    // Chance a commitable node starts a change chain
+    double changeChainChance = 0.1;
+    // Longest change chain, counting the first version
+    size_t changeChainMax = 4;
+    // Dates are spread around this (seconds since the epoch). It's
+    // fixed rather than today so the seed alone decides the graph.
+    time_t baseDate = 1767225600; // 2026-01-01 UTC
+
+    // Handles one "--flag value" pair from the command line. Returns
+    // false if the flag isn't a generator flag. Shared by the
+    // generator CLI and GraphEditorBench so they take the same flags.
+    bool parse(std::string_view flag, const char *value) {
+      if (flag == "--seed") {
+        seed = std::strtoull(value, nullptr, 10);
+      } else if (flag == "--fan-out") {
+        fanOut = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+      } else if (flag == "--depth") {
+        maxDepth = std::strtoull(value, nullptr, 10);
+      } else if (flag == "--text-min") {
+        textSizeMin = std::strtoull(value, nullptr, 10);
+      } else if (flag == "--text-max") {
+        textSizeMax = std::strtoull(value, nullptr, 10);
+      } else if (flag == "--text-distribution") {
+        std::string_view dist(value);
+        if (dist == "fixed") {
+          textDistribution = TextSizeDistribution::Fixed;
+        } else if (dist == "uniform") {
+          textDistribution = TextSizeDistribution::Uniform;
+        } else if (dist == "loguniform") {
+          textDistribution = TextSizeDistribution::LogUniform;
+        } else {
+          return false;
+        }
+      } else if (flag == "--change-chains") {
+        changeChainChance = std::strtod(value, nullptr);
+      } else if (flag == "--chain-length") {
+        changeChainMax = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+      } else if (flag == "--base-date") {
+        baseDate = static_cast<time_t>(std::strtoll(value, nullptr, 10));
+      } else {
+        return false;
+      }
+      return true;
+    }
+
+    static constexpr char usage[] =
+      "[--seed 1] [--fan-out 4] [--depth 0] [--text-min 16] [--text-max 256]"
+      " [--text-distribution fixed|uniform|loguniform]"
+      " [--change-chains 0.1] [--chain-length 4] [--base-date 1767225600]";
+  };
+
+  /**
+   * What ended up in the last generated graph
+   */
+
+  struct GraphGeneratorStats {
+    size_t nodes = 0;
+    size_t maxDepth = 0;
+    size_t changeChains = 0;
+    size_t committed = 0;
+    size_t textBytes = 0;
+    // Node count per Registration::Record name, in WindowList order
+    std::vector<std::pair<const char *, size_t>> perType;
+  };
+
+  /**
+   * GraphGenerator builds random but valid graphs out of the node
+   * types in WindowList, for benchmarking load, layout and render
+   * times on inputs too big to put together through the menus.
+   *
+   * The root is always a GraphNode. The first node of every type in
+   * WindowList gets created before any type repeats, so any graph
+   * with more nodes than WindowList has types covers all of them.
+   * Up/down links are set on both ends the same way
+   * NodeAnchor::establishConnection sets them. Commitable nodes may
+   * start a change chain; every version but the last is committed
+   * and each version hangs off the same up node as the first, so
+   * the whole chain is reachable with traverse.
+   *
+   * The result can be written out with cereal or handed straight to
+   * WindowFactory::add.
+   */
+
+  template <typename WindowList>
+  requires fr::types::IsUnique<WindowList>
+  class GraphGenerator {
+    using Node = fr::RequirementsManager::Node;
+    using CommitableNode = fr::RequirementsManager::CommitableNode;
+
+    struct NodeMaker {
+      const char *name;
+      bool commitable;
+      std::function<Node::PtrType()> make;
+    };
+
+    GraphGeneratorOptions _options;
+    GraphGeneratorStats _stats;
+    std::mt19937_64 _random;
+    std::vector<NodeMaker> _makers;
+    // Long text fields are slices of this so we don't have to
+    // generate megabytes of words per field
+    std::string _filler;
+
+    static constexpr const char *words[] = {
+      "the", "system", "shall", "allow", "user", "to", "record", "each",
+      "requirement", "with", "a", "clear", "and", "testable", "outcome",
+      "so", "that", "project", "goals", "stay", "aligned", "over", "time",
+      "when", "product", "changes", "are", "committed", "reviewed", "by"
+    };
+    static constexpr size_t wordCount = sizeof(words) / sizeof(words[0]);
+
+    size_t pick(size_t min, size_t max) {
+      return std::uniform_int_distribution<size_t>(min, max)(_random);
+    }
+
+    bool chance(double p) {
+      return std::bernoulli_distribution(std::clamp(p, 0.0, 1.0))(_random);
+    }
+
+    size_t textSize() {
+      size_t min = std::min(_options.textSizeMin, _options.textSizeMax);
+      size_t max = _options.textSizeMax;
+      switch (_options.textDistribution) {
+      case TextSizeDistribution::Fixed:
+        return max;
+      case TextSizeDistribution::Uniform:
+        return pick(min, max);
+      case TextSizeDistribution::LogUniform: {
+        double lo = std::log(static_cast<double>(std::max<size_t>(min, 1)));
+        double hi = std::log(static_cast<double>(std::max<size_t>(max, 1)));
+        double size = std::exp(std::uniform_real_distribution<double>(lo, hi)(_random));
+        return std::clamp(static_cast<size_t>(size), min, max);
+      }
+      }
+      return max;
+    }
+
+    // Rebuilt on every generate so the random sequence, and so the
+    // graph, only depends on the seed
+    void buildFiller() {
+      size_t needed = _options.textSizeMax + 1;
+      _filler.clear();
+      // Twice the longest field so slices start at different places
+      _filler.reserve(needed * 2);
+      while (_filler.size() < needed * 2) {
+        _filler += words[pick(0, wordCount - 1)];
+        _filler += ' ';
+      }
+    }
+
+    // A long text field
+    std::string text() {
+      size_t size = textSize();
+      size_t offset = pick(0, _filler.size() - size - 1);
+      _stats.textBytes += size;
+      return _filler.substr(offset, size);
+    }
+
+    // A short text field, like a name or a title
+    std::string shortText(size_t count = 3) {
+      std::string ret;
+      for (size_t i = 0; i < count; ++i) {
+        if (i) {
+          ret += ' ';
+        }
+        ret += words[pick(0, wordCount - 1)];
+      }
+      _stats.textBytes += ret.size();
+      return ret;
+    }
+
+    std::string digits(size_t count) {
+      std::string ret;
+      for (size_t i = 0; i < count; ++i) {
+        ret += static_cast<char>('0' + pick(0, 9));
+      }
+      return ret;
+    }
+
+    time_t date() {
+      // Somewhere within a year either way
+      return _options.baseDate + static_cast<time_t>(pick(0, 2 * 365)) * 86400 - 365 * 86400;
+    }
+
+    // Fill in node fields. Types without an overload here just keep
+    // whatever init gave them.
+    template <typename NodeType>
+    void fill(std::shared_ptr<NodeType>) {}
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Actor> node) {
+      node->setActor(shortText(2));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Completed> node) {
+      node->setDescription(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Effort> node) {
+      node->setText(text());
+      node->setEffort(pick(1, 80) * 3600);
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::EmailAddress> node) {
+      node->setAddress(std::format("{}@example.com", words[pick(0, wordCount - 1)]));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Event> node) {
+      node->setName(shortText());
+      node->setDescription(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Goal> node) {
+      node->setAction(text());
+      node->setOutcome(text());
+      node->setContext(text());
+      node->setAlignment(text());
+      node->setTargetDate(date());
+      node->setTargetDateConfidence(shortText(1));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::GraphNode> node) {
+      node->setTitle(shortText(4));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::InternationalAddress> node) {
+      node->setCountryCode(digits(2));
+      node->setLocality(shortText(1));
+      node->setPostalCode(digits(6));
+      node->setAddressLines(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::KeyValue> node) {
+      node->setKey(shortText(1));
+      node->setValue(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Organization> node) {
+      node->setName(shortText(2));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Person> node) {
+      node->setFirstName(shortText(1));
+      node->setLastName(shortText(1));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::PhoneNumber> node) {
+      node->setCountryCode(digits(1));
+      node->setNumber(digits(10));
+      node->setPhoneType(chance(0.5) ? "Mobile" : "Work");
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Product> node) {
+      node->setTitle(shortText());
+      node->setDescription(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Project> node) {
+      node->setName(shortText());
+      node->setDescription(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Purpose> node) {
+      node->setDescription(text());
+      node->setDeadline(date());
+      node->setDeadlineConfidence(shortText(1));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Requirement> node) {
+      node->setTitle(shortText());
+      node->setText(text());
+      node->setFunctional(chance(0.5));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Role> node) {
+      node->setWho(shortText(2));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Story> node) {
+      node->setTitle(shortText());
+      node->setGoal(text());
+      node->setBenefit(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::Text> node) {
+      node->setText(text());
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::TimeEstimate> node) {
+      node->setText(text());
+      node->setEstimate(pick(1, 60) * 86400);
+      if (chance(0.5)) {
+        node->setStarted(true);
+        node->setStartTimestamp(date());
+      }
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::USAddress> node) {
+      node->setAddressLines(text());
+      node->setCity(shortText(1));
+      node->setState(shortText(1));
+      node->setZipCode(digits(5));
+    }
+
+    void fill(std::shared_ptr<fr::RequirementsManager::UseCase> node) {
+      node->setName(shortText());
+    }
+
+    // Walks WindowList and sets up a maker for every window's node type
+    template <typename Windows>
+    void addMakers() {
+      using CurrentWindow = Windows::head::type;
+      if constexpr (!std::is_void_v<CurrentWindow>) {
+        using NodeType = Registration::Record<CurrentWindow>::NodeType;
+        if constexpr (!std::is_void_v<NodeType>) {
+          _makers.push_back(NodeMaker{
+              Registration::Record<CurrentWindow>::name,
+              std::is_base_of_v<CommitableNode, NodeType>,
+              [this]() -> Node::PtrType {
+                auto node = std::make_shared<NodeType>();
+                node->init();
+                fill(node);
+                return node;
+              }});
+        }
+        if constexpr (!std::is_void_v<typename Windows::tail::head::type>) {
+          addMakers<typename Windows::tail>();
+        }
+      }
+    }
+
+    size_t makerFor(const char *name) {
+      for (size_t i = 0; i < _makers.size(); ++i) {
+        if (std::string_view(_makers[i].name) == name) {
+          return i;
+        }
+      }
+      return 0;
+    }
+
+    Node::PtrType make(size_t maker) {
+      _stats.perType[maker].second++;
+      _stats.nodes++;
+      return _makers[maker].make();
+    }
+
+    static void link(Node::PtrType up, Node::PtrType down) {
+      up->addDown(down);
+      down->addUp(up);
+    }
+
+  public:
+    GraphGenerator(const GraphGeneratorOptions &options = GraphGeneratorOptions()) : _options(options) {
+      addMakers<WindowList>();
+    }
+
+    // The makers capture this
+    GraphGenerator(const GraphGenerator &) = delete;
+    GraphGenerator &operator=(const GraphGenerator &) = delete;
+
+    const GraphGeneratorStats &stats() const {
+      return _stats;
+    }
+
+    Node::PtrType generate() {
+      _random.seed(_options.seed);
+      _stats = GraphGeneratorStats();
+      for (const auto &maker : _makers) {
+        _stats.perType.emplace_back(maker.name, 0);
+      }
+      buildFiller();
+
+      auto root = make(makerFor(Registration::Record<GraphNodeWindow>::name));
+      // Nodes that can still take down nodes, breadth first, with
+      // their depth
+      std::deque<std::pair<Node::PtrType, size_t>> open;
+      // Every node above maxDepth, for when open runs dry
+      std::vector<std::pair<Node::PtrType, size_t>> parents;
+      open.emplace_back(root, 0);
+      parents.emplace_back(root, 0);
+      size_t nextType = 0;
+
+      while (_stats.nodes < _options.nodeCount) {
+        std::pair<Node::PtrType, size_t> parent;
+        size_t children;
+        if (!open.empty()) {
+          parent = open.front();
+          open.pop_front();
+          children = pick(1, _options.fanOut);
+        } else {
+          // maxDepth stopped the tree from growing, so spread the rest
+          // over the levels we already have
+          parent = parents[pick(0, parents.size() - 1)];
+          children = 1;
+        }
+
+        for (size_t i = 0; i < children && _stats.nodes < _options.nodeCount; ++i) {
+          size_t maker = nextType < _makers.size() ? nextType++ : pick(0, _makers.size() - 1);
+          auto node = make(maker);
+          size_t depth = parent.second + 1;
+          _stats.maxDepth = std::max(_stats.maxDepth, depth);
+          link(parent.first, node);
+          if (_options.maxDepth == 0 || depth < _options.maxDepth) {
+            open.emplace_back(node, depth);
+            parents.emplace_back(node, depth);
+          }
+
+          if (_makers[maker].commitable && chance(_options.changeChainChance)) {
+            auto version = std::dynamic_pointer_cast<CommitableNode>(node);
+            size_t length = pick(2, std::max<size_t>(2, _options.changeChainMax));
+            _stats.changeChains++;
+            for (size_t v = 1; v < length && _stats.nodes < _options.nodeCount; ++v) {
+              auto next = std::dynamic_pointer_cast<CommitableNode>(make(maker));
+              link(parent.first, next);
+              version->addChangeChild(next);
+              version->commit();
+              _stats.committed++;
+              version = next;
+            }
+          }
+        }
+      }
+      return root;
+    }
+  };
+
+}
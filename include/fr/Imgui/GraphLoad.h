@@ -0,0 +1,201 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fr/Imgui/NodeHandles.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace fr::Imgui {
+
+  /**
+   * One graph file being read in on a factory's threadpool (see
+   * WindowFactory::loadGraph). The UI thread watches it for progress
+   * and can cancel it. Once it's read it remembers which graph the
+   * factory filed the nodes under, so opening the same file again
+   * while that graph is open doesn't read it a second time. It
+   * doesn't keep the nodes itself, the factory owns those.
+   */
+
+  class GraphLoad {
+  public:
+    enum class State {
+      // Reading and parsing the file
+      Reading,
+      // Parsed and handed to the factory, which is making windows
+      Queued,
+      Failed,
+      Cancelled
+    };
+
+    using PtrType = std::shared_ptr<GraphLoad>;
+
+  private:
+    std::string _path;
+    std::string _name;
+    // Size and modification time when the load started, to tell if
+    // the file changed since
+    std::uintmax_t _fileSize;
+    std::filesystem::file_time_type _modified;
+    std::atomic<State> _state;
+    std::atomic<bool> _cancelled;
+    std::atomic<size_t> _bytesRead;
+    std::atomic<GraphId> _graph;
+    // Guards _error
+    mutable std::mutex _mutex;
+    std::string _error;
+
+  public:
+    explicit GraphLoad(const std::string &path) :
+      _path(path),
+      _name(std::filesystem::path(path).filename().string()),
+      _fileSize(0),
+      _state(State::Reading),
+      _cancelled(false),
+      _bytesRead(0),
+      _graph(invalidGraphId) {
+      std::error_code error;
+      _fileSize = std::filesystem::file_size(path, error);
+      if (error) {
+        _fileSize = 0;
+      }
+      _modified = std::filesystem::last_write_time(path, error);
+    }
+
+    const std::string &path() const {
+      return _path;
+    }
+
+    // File name, for the UI
+    const std::string &name() const {
+      return _name;
+    }
+
+    // True if the file on disk is still the one this load read
+    bool current() const {
+      std::error_code error;
+      auto size = std::filesystem::file_size(_path, error);
+      if (error || size != _fileSize) {
+        return false;
+      }
+      auto modified = std::filesystem::last_write_time(_path, error);
+      return !error && modified == _modified;
+    }
+
+    State state() const {
+      return _state.load(std::memory_order_acquire);
+    }
+
+    void setState(State state) {
+      _state.store(state, std::memory_order_release);
+    }
+
+    // Ask the reader to stop. A load that's already queued its graph
+    // has to be closed through the factory instead.
+    void cancel() {
+      _cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    bool cancelled() const {
+      return _cancelled.load(std::memory_order_relaxed);
+    }
+
+    void addBytesRead(size_t bytes) {
+      _bytesRead.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    // How much of the file has been read, 0 to 1
+    float fraction() const {
+      if (_fileSize == 0) {
+        return 0.0f;
+      }
+      return static_cast<float>(_bytesRead.load(std::memory_order_relaxed)) / static_cast<float>(_fileSize);
+    }
+
+    // Graph the factory filed the parsed nodes under
+    GraphId graph() const {
+      return _graph.load(std::memory_order_acquire);
+    }
+
+    void setGraph(GraphId graph) {
+      _graph.store(graph, std::memory_order_release);
+    }
+
+    std::string error() const {
+      std::lock_guard<std::mutex> lock(_mutex);
+      return _error;
+    }
+
+    void fail(const std::string &error) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _error = error;
+      }
+      setState(State::Failed);
+    }
+  };
+
+  /**
+   * Reads a file for a GraphLoad. Counts the bytes as they go by and
+   * stops handing them out once the load is cancelled, which makes
+   * the parser fail and gives the thread back.
+   */
+
+  class GraphLoadStreambuf : public std::streambuf {
+    std::filebuf _file;
+    std::vector<char> _buffer;
+    GraphLoad &_load;
+
+  public:
+    static constexpr size_t bufferSize = 64 * 1024;
+
+    explicit GraphLoadStreambuf(GraphLoad &load) : _buffer(bufferSize), _load(load) {
+      _file.open(load.path(), std::ios::in | std::ios::binary);
+    }
+
+    bool is_open() const {
+      return _file.is_open();
+    }
+
+  protected:
+    int_type underflow() override {
+      if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+      }
+      if (_load.cancelled()) {
+        return traits_type::eof();
+      }
+      std::streamsize count = _file.sgetn(_buffer.data(), _buffer.size());
+      if (count <= 0) {
+        return traits_type::eof();
+      }
+      _load.addBytesRead(static_cast<size_t>(count));
+      setg(_buffer.data(), _buffer.data(), _buffer.data() + count);
+      return traits_type::to_int_type(*gptr());
+    }
+  };
+
+}
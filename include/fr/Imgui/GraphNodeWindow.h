@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/Imgui/NodeEditorWindow.h>
 #include <fr/RequirementsManager/GraphNode.h>
 #include <fr/RequirementsManager/RestFactoryApi.h>
@@ -32,22 +32,26 @@
 #include <ImGuiFileDialog.h>
 #endif
 
+#ifndef NO_LOAD_SAVE_JSON
+#include <fr/Imgui/GraphSave.h>
+#endif
+
 namespace fr::Imgui {
 
-  class GraphNodeWindow : public NodeWindow {
+  class GraphNodeWindow : public TypedNodeWindow<fr::RequirementsManager::GraphNode> {
     static const size_t titleTextLen = 201;
     static const size_t urlLen = 301;
     char _titleText[titleTextLen];
     char _url[urlLen];
-    std::string _titleTextLabel;
-    std::string _saveLabel;
-    std::string _jsonSaveLabel;
-    std::string _fileLabel;
+    const char *_titleTextLabel;
+    const char *_saveLabel;
+    const char *_fileSaveLabel;
+    const char *_fileLabel;
     std::string _fileDialogLabel;
-    std::string _restSaveLabel;
+    const char *_restSaveLabel;
     std::string _restSaveWindowLabel;
-    std::string _saveTextBoxLabel;
-    std::string _restSaveButtonLabel;
+    const char *_saveTextBoxLabel;
+    const char *_restSaveButtonLabel;
     bool _display;
     bool _showPopup;
     
@@ -66,58 +70,141 @@ namespace fr::Imgui {
 
     std::shared_ptr<SaveNodesNode> _saver;
 #endif
-    std::shared_ptr<ThreadPool> _threadpool;   
+    std::shared_ptr<ThreadPool> _threadpool;
+    // Set if _threadpool is ours rather than the editor's
+    bool _ownThreadpool;
+#ifndef NO_LOAD_SAVE_JSON
+    // Most recent JSON save, for the status line
+    GraphSave::PtrType _save;
+    // Windows frozen for _save, thawed once it's done
+    std::vector<std::weak_ptr<NodeWindow>> _frozenWindows;
+#endif
     
     void setTitleText() {
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::GraphNode>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_titleText, node->getTitle().c_str(), titleTextLen - 1);
       }
     }
 
+    // The editor's threadpool if it has one, otherwise one of our own
+    std::shared_ptr<ThreadPool> threadpool() {
+      if (!_threadpool) {
+        auto parentNodeEditor = std::dynamic_pointer_cast<NodeEditorWindow<AllWindowList>>(_parent.lock());
+        if (parentNodeEditor) {
+          _threadpool = parentNodeEditor->threadpool;
+        }
+        if (!_threadpool) {
+          _threadpool = std::make_shared<ThreadPool>();
+          _threadpool->startThreads(4);
+          _ownThreadpool = true;
+        }
+      }
+      return _threadpool;
+    }
+
+#ifndef NO_LOAD_SAVE_JSON
+    // Freeze every window showing a node in the graph so nothing
+    // changes while the save reads it, then write it out on the
+    // threadpool. Walking the graph is just pointer chasing, the
+    // slow part (formatting and writing) happens off the UI thread.
+    // The extension picks the format (see graphFormatFor).
+    void saveGraph(const std::string &path) {
+      auto handles = getNodeHandles();
+      auto freezeWindow = [&](const fr::RequirementsManager::Node::PtrType &node) {
+        if (!handles) {
+          return;
+        }
+        auto window = std::dynamic_pointer_cast<NodeWindow>(handles->window(handles->find(node)));
+        if (window) {
+          window->freeze();
+          _frozenWindows.push_back(window);
+        }
+      };
+      freezeWindow(_node);
+      _node->traverse([&](fr::RequirementsManager::Node::PtrType nextNode) {
+        freezeWindow(nextNode);
+      });
+      if (!handles) {
+        // Not in an editor, so it's only us
+        freeze();
+        _frozenWindows.push_back(std::static_pointer_cast<NodeWindow>(shared_from_this()));
+      }
+      _save = std::make_shared<GraphSave>(path);
+      threadpool()->enqueue(std::make_shared<GraphSaveTask<WorkerThread>>(_node, _save));
+    }
+
+    void thawWindows() {
+      for (auto &weak : _frozenWindows) {
+        if (auto window = weak.lock()) {
+          window->thaw();
+        }
+      }
+      _frozenWindows.clear();
+    }
+
+    bool saving() const {
+      return _save && _save->state() == GraphSave::State::Saving;
+    }
+#endif
+
   public:
 
     using Type = GraphNodeWindow;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::GraphNode>;
     using PtrType = std::shared_ptr<Type>;
     using NodeType = fr::RequirementsManager::GraphNode;
 
     GraphNodeWindow(std::string title = "GraphNode")
       : Parent(title),
-        _factory(nullptr)
+        _factory(nullptr),
+        _ownThreadpool(false)
     {
       memset(_titleText, '\0', titleTextLen);
       memset(_url, '\0', urlLen);
-      _titleTextLabel = getUniqueLabel("##Title");
-      _saveLabel = getUniqueLabel("Save to Database");
-      _jsonSaveLabel = getUniqueLabel("Save to JSON File");
-      _fileLabel = getUniqueLabel("File");
+      _titleTextLabel = "##Title";
+      _saveLabel = "Save to Database";
+      _fileSaveLabel = "Save to File";
+      _fileLabel = "File";
       _fileDialogLabel = getUniqueLabel("FileDialog");
-      _restSaveLabel = getUniqueLabel("Save to REST Service");
+      _restSaveLabel = "Save to REST Service";
       _restSaveWindowLabel = getUniqueLabel("Save to REST");
-      _saveTextBoxLabel = getUniqueLabel("##URL");
-      _restSaveButtonLabel = getUniqueLabel("Save");
+      _saveTextBoxLabel = "##URL";
+      _restSaveButtonLabel = "Save";
       _fileDialogSize.x = 600;
       _fileDialogSize.y = 400;
       _showPopup = false;
       _display = false;
     }
 
-    virtual ~GraphNodeWindow() {}
+    virtual ~GraphNodeWindow() {
+      if (_ownThreadpool) {
+        // Lets a save that's still going finish first
+        _threadpool->shutdown();
+        _threadpool->join();
+      }
+#ifndef NO_LOAD_SAVE_JSON
+      thawWindows();
+#endif
+    }
 
     void setFactory(fr::RequirementsManager::GraphNodeFactory* factory) {
       _factory = factory;
     }
     
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::GraphNode>();
-        _node->init();
-      }
+      ensureNode();
       setTitleText();
       Parent::init();
     }
 
+    // The file dialog and REST popup are drawn from begin, so they'd
+    // vanish if the window got culled. There aren't many of these
+    // per graph, so just never cull them.
+    bool cullable() override {
+      return false;
+    }
+
     void Begin() override {
       // Override Begin so we can set this window up with a menu bar.
       ImGui::Begin(_label.c_str(), nullptr, ImGuiWindowFlags_MenuBar);      
@@ -126,23 +213,29 @@ namespace fr::Imgui {
     void begin() override {
       Parent::begin();
       auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-      if (_editable) {
+      if (editable()) {
         inputTextFlags = (ImGuiInputTextFlags_) 0;
       }
 
       ImGui::Text("Title: ");
       ImGui::SameLine();
-      if (ImGui::InputText(_titleTextLabel.c_str(), _titleText, titleTextLen - 1, inputTextFlags)) {
-        auto node = dynamic_pointer_cast<fr::RequirementsManager::GraphNode>(_node);
+      if (ImGui::InputText(_titleTextLabel, _titleText, titleTextLen - 1, inputTextFlags)) {
+        auto node = _typedNode;
         if (node) {
           node->setTitle(_titleText);
         }
       }
      
       if (ImGui::BeginMenuBar()) {
-        if (ImGui::BeginMenu(_fileLabel.c_str())) {
+        if (ImGui::BeginMenu(_fileLabel)) {
 #ifndef NO_SQL
-          if (ImGui::MenuItem(_saveLabel.c_str())) {
+          // Marking the nodes changed writes to them, so not while a
+          // file save is reading them
+          bool canSaveToDatabase = true;
+#ifndef NO_LOAD_SAVE_JSON
+          canSaveToDatabase = !saving();
+#endif
+          if (ImGui::MenuItem(_saveLabel, nullptr, false, canSaveToDatabase)) {
             // Save to Database
             // Right now I'm just going to set all the nodes' change flags to true
             // and kick off a save. I'll need to do a visual indicator to indicate that
@@ -152,30 +245,26 @@ namespace fr::Imgui {
             _node->traverse([](fr::RequirementsManager::Node::PtrType nextNode) {
               nextNode->changed = true;
             });
-            // If our parent is a NodeEditorWindow, get its threadpool
-            auto parentNodeEditor = std::dynamic_pointer_cast<NodeEditorWindow<AllWindowList>>(_parent);
-            if (!_threadpool && parentNodeEditor) {
-              _threadpool = parentNodeEditor->threadpool;
-            } else {
-              if (!_threadpool) {
-                _threadpool = std::make_shared<ThreadPool>();
-                _threadpool->startThreads(4);
-              }
-            }
             if (!_saver) {
               _saver = std::make_shared<SaveNodesNode>(_node);
             }
             // TODO: Set saver's complete callback up to indicate data was saved
-            _threadpool->enqueue(_saver);
+            threadpool()->enqueue(_saver);
           }
 #endif
 #ifndef NO_LOAD_SAVE_JSON
-          if (ImGui::MenuItem(_jsonSaveLabel.c_str())) {
-            ImGuiFileDialog::Instance()->OpenDialog(_fileDialogLabel, "Save to JSON", ".json");
+          // Windows that come in while loading wouldn't be frozen, so
+          // wait for the editor to finish first
+          auto parentNodeEditor = std::dynamic_pointer_cast<NodeEditorWindow<AllWindowList>>(_parent.lock());
+          bool canSave = !saving() && !(parentNodeEditor && parentNodeEditor->loading());
+          if (ImGui::MenuItem(_fileSaveLabel, nullptr, false, canSave)) {
+            // The dialog adds the chosen filter's extension, and that
+            // picks the format
+            ImGuiFileDialog::Instance()->OpenDialog(_fileDialogLabel, "Save to File", graphFileFilters);
           }
 #endif
           if (_factory) {
-            if (ImGui::MenuItem(_restSaveLabel.c_str())) {
+            if (ImGui::MenuItem(_restSaveLabel)) {
               _display = true;
             }
           }
@@ -188,14 +277,26 @@ namespace fr::Imgui {
       if (ImGuiFileDialog::Instance()->Display(_fileDialogLabel, ImGuiWindowFlags_NoCollapse, _fileDialogSize, _fileDialogSize)) {
         if (ImGuiFileDialog::Instance()->IsOk()) {
           std::string filePathName = ImGuiFileDialog::Instance()->GetFilePathName();
-          std::ofstream streamOut(filePathName);
-          {
-            cereal::JSONOutputArchive archive(streamOut);
-            archive(_node);
-          }
+          saveGraph(filePathName);
         }
         ImGuiFileDialog::Instance()->Close();
-      }      
+      }
+
+      if (_save) {
+        switch (_save->state()) {
+        case GraphSave::State::Saving:
+          ImGui::TextDisabled("Saving %s...", _save->path().c_str());
+          break;
+        case GraphSave::State::Saved:
+          thawWindows();
+          ImGui::TextDisabled("Saved %s", _save->path().c_str());
+          break;
+        case GraphSave::State::Failed:
+          thawWindows();
+          ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Save failed: %s", _save->error().c_str());
+          break;
+        }
+      }
 #endif
 
       if (_display) {
@@ -204,8 +305,8 @@ namespace fr::Imgui {
           
         ImGui::Text("URL: ");
         ImGui::SameLine();
-        ImGui::InputText(_saveTextBoxLabel.c_str(), _url, urlLen - 1);
-        if (ImGui::Button(_restSaveButtonLabel.c_str())) {
+        ImGui::InputText(_saveTextBoxLabel, _url, urlLen - 1);
+        if (ImGui::Button(_restSaveButtonLabel)) {
           _factory->post(_url, _node);
           _display = false;
         }
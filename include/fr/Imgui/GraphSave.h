@@ -0,0 +1,196 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fr/Imgui/GraphFile.h>
+#include <fr/Imgui/Log.h>
+#include <fr/Imgui/Profiler.h>
+#include <fr/Imgui/RenderWake.h>
+#include <fr/RequirementsManager/Node.h>
+#include <fr/RequirementsManager/TaskNode.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace fr::Imgui {
+
+  /**
+   * How a background save of one graph is going. The UI thread polls
+   * it, the save task fills it in.
+   */
+
+  class GraphSave {
+  public:
+    enum class State {
+      Saving,
+      Saved,
+      Failed
+    };
+
+    using PtrType = std::shared_ptr<GraphSave>;
+
+  private:
+    std::string _path;
+    std::atomic<State> _state;
+    // Guards _error
+    mutable std::mutex _mutex;
+    std::string _error;
+
+  public:
+    explicit GraphSave(const std::string &path) : _path(path), _state(State::Saving) {
+    }
+
+    const std::string &path() const {
+      return _path;
+    }
+
+    State state() const {
+      return _state.load(std::memory_order_acquire);
+    }
+
+    void succeed() {
+      _state.store(State::Saved, std::memory_order_release);
+    }
+
+    void fail(const std::string &error) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _error = error;
+      }
+      _state.store(State::Failed, std::memory_order_release);
+    }
+
+    std::string error() const {
+      std::lock_guard<std::mutex> lock(_mutex);
+      return _error;
+    }
+  };
+
+  // Name to write path's new contents to before renaming it into
+  // place. It's in the same directory so the rename doesn't cross
+  // filesystems, and the pid and a counter keep two saves of the same
+  // path (from this editor or another one) out of each other's file.
+  inline std::string temporaryGraphPath(const std::string &path) {
+    static std::atomic<uint64_t> nextSave{0};
+#ifdef _WIN32
+    auto pid = _getpid();
+#else
+    auto pid = ::getpid();
+#endif
+    return std::format("{}.{}.{}.tmp", path, pid, nextSave.fetch_add(1, std::memory_order_relaxed));
+  }
+
+  /**
+   * Writes a graph file on a threadpool, in the format its extension
+   * asks for (see graphFormatFor). The graph's windows
+   * have to stay frozen (NodeWindow::freeze) until the save's done,
+   * that's what keeps the nodes still while this reads them.
+   *
+   * The graph goes to a temporary file next to the real one, which
+   * gets renamed over it at the end. A save that fails part way
+   * leaves whatever was there before alone.
+   */
+
+  template <typename WorkerThreadType>
+  class GraphSaveTask : public fr::RequirementsManager::TaskNode<WorkerThreadType> {
+    fr::RequirementsManager::Node::PtrType _root;
+    GraphSave::PtrType _save;
+
+  public:
+    using Type = GraphSaveTask;
+    using Parent = fr::RequirementsManager::TaskNode<WorkerThreadType>;
+    using PtrType = std::shared_ptr<GraphSaveTask<WorkerThreadType>>;
+
+    // Writes go through a buffer this big rather than the stream's
+    // default
+    static constexpr size_t bufferSize = 1024 * 1024;
+
+    GraphSaveTask(fr::RequirementsManager::Node::PtrType root, GraphSave::PtrType save) :
+      _root(std::move(root)),
+      _save(std::move(save)) {
+    }
+
+    virtual ~GraphSaveTask() {}
+
+    void run() override {
+      FR_PROFILE_SCOPE("GraphSaveTask::run");
+      auto start = std::chrono::steady_clock::now();
+      const std::string &path = _save->path();
+      std::string temporary = temporaryGraphPath(path);
+      std::string error;
+      auto format = graphFormatFor(path);
+      {
+        std::vector<char> buffer(bufferSize);
+        std::ofstream out;
+        out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        std::ios::openmode mode = std::ios::out | std::ios::trunc;
+        if (format == GraphFormat::Binary) {
+          mode |= std::ios::binary;
+        }
+        out.open(temporary, mode);
+        if (!out) {
+          error = "could not open " + temporary;
+        } else {
+          try {
+            writeGraph(out, _root, format);
+          } catch (const std::exception &e) {
+            error = e.what();
+          }
+          out.close();
+          if (error.empty() && !out) {
+            error = "could not write " + temporary;
+          }
+        }
+      }
+      if (error.empty()) {
+        std::error_code renameError;
+        std::filesystem::rename(temporary, path, renameError);
+        if (renameError) {
+          error = renameError.message();
+        }
+      }
+      if (!error.empty()) {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        FR_LOG_WARN(General, "Could not save {}: {}", path, error);
+        _save->fail(error);
+      } else {
+        FR_LOG_INFO(General, "Saved {} in {:.3f} ms", path,
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        _save->succeed();
+      }
+      // Nothing else holds the nodes up once the editor lets go
+      _root.reset();
+      RenderWake::instance().request();
+    }
+  };
+
+}
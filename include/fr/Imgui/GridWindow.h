@@ -16,20 +16,115 @@
 
 #pragma once
 #include <fr/Imgui/Window.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <imgui.h>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace fr::Imgui {
 
   /**
-   * A window with a grid drawn on it.
+   * A window with a grid drawn on it. The grid sits on a Canvas that
+   * children get drawn through, so dragging the background with the
+   * right or middle mouse button pans and the mouse wheel zooms.
    */
   
   class GridWindow : public Window {
   protected:
     float _squareSize;
     unsigned int _gridLineColor;
+    // Canvas this window and its children share
+    Canvas _gridCanvas;
+    // Links between the node windows on this canvas
+    EdgeStore _gridEdges;
+    // Where the node anchors on this canvas are
+    AnchorIndex _gridAnchors;
+    // Handles for the nodes shown on this canvas
+    NodeHandles _gridHandles;
+    // Anchors this close to the mouse get to submit ImGui items
+    static constexpr float anchorHotRadius = 16.0f;
+    // When zoomed far out grid squares get merged until they're at
+    // least this many pixels across, so the line count stays sane
+    static constexpr float minimumGridSpacing = 8.0f;
+    // Zoom factor for one notch of the mouse wheel
+    static constexpr float wheelZoomStep = 1.1f;
+
+    // Everything the grid geometry depends on. The geometry only
+    // gets rebuilt when one of these changes.
+    struct GridGeometryKey {
+      // Visible part of the window, in screen coordinates
+      float minX = 0.0f;
+      float minY = 0.0f;
+      float maxX = 0.0f;
+      float maxY = 0.0f;
+      // First line in each direction and the space between lines
+      float startX = 0.0f;
+      float startY = 0.0f;
+      float spacing = 0.0f;
+      ImU32 color = 0;
+      // The font atlas white pixel, which can move if the atlas grows
+      float u = 0.0f;
+      float v = 0.0f;
+
+      bool operator==(const GridGeometryKey &) const = default;
+    };
+
+    // Grid lines as one quad each, ready to be copied into the draw
+    // list. Indices start at 0 and get offset when they're copied.
+    GridGeometryKey _gridKey;
+    std::vector<ImDrawVert> _gridVertices;
+    std::vector<ImDrawIdx> _gridIndices;
+
+    void addGridQuad(ImVec2 a, ImVec2 b, ImVec2 uv, ImU32 color) {
+      auto base = static_cast<ImDrawIdx>(_gridVertices.size());
+      _gridVertices.push_back({a, uv, color});
+      _gridVertices.push_back({ImVec2(b.x, a.y), uv, color});
+      _gridVertices.push_back({b, uv, color});
+      _gridVertices.push_back({ImVec2(a.x, b.y), uv, color});
+      for (ImDrawIdx i : {0, 1, 2, 0, 2, 3}) {
+        _gridIndices.push_back(static_cast<ImDrawIdx>(base + i));
+      }
+    }
+
+    void buildGrid(const GridGeometryKey &key) {
+      FR_PROFILE_COUNT("Grid rebuilds", 1);
+      _gridVertices.clear();
+      _gridIndices.clear();
+      ImVec2 uv(key.u, key.v);
+
+      for (float y = key.startY; y < key.maxY; y += key.spacing) {
+        addGridQuad(ImVec2(key.minX, y), ImVec2(key.maxX, y + 1.0f), uv, key.color);
+      }
+      for (float x = key.startX; x < key.maxX; x += key.spacing) {
+        addGridQuad(ImVec2(x, key.minY), ImVec2(x + 1.0f, key.maxY), uv, key.color);
+      }
+
+      // Border
+      addGridQuad(ImVec2(key.minX, key.minY), ImVec2(key.maxX, key.minY + 1.0f), uv, key.color);
+      addGridQuad(ImVec2(key.minX, key.maxY - 1.0f), ImVec2(key.maxX, key.maxY), uv, key.color);
+      addGridQuad(ImVec2(key.minX, key.minY), ImVec2(key.minX + 1.0f, key.maxY), uv, key.color);
+      addGridQuad(ImVec2(key.maxX - 1.0f, key.minY), ImVec2(key.maxX, key.maxY), uv, key.color);
+    }
+
+    // Copies the cached grid into the draw list. It lands in the
+    // current draw command, so the whole grid is one block of
+    // vertices no matter how big the canvas is.
+    void spliceGrid(ImDrawList *drawList) {
+      int vertexCount = static_cast<int>(_gridVertices.size());
+      int indexCount = static_cast<int>(_gridIndices.size());
+      drawList->PrimReserve(indexCount, vertexCount);
+      // PrimReserve can start a new vertex offset, so read this after
+      auto base = static_cast<ImDrawIdx>(drawList->_VtxCurrentIdx);
+      std::memcpy(drawList->_VtxWritePtr, _gridVertices.data(), vertexCount * sizeof(ImDrawVert));
+      for (ImDrawIdx index : _gridIndices) {
+        *drawList->_IdxWritePtr++ = static_cast<ImDrawIdx>(base + index);
+      }
+      drawList->_VtxWritePtr += vertexCount;
+      drawList->_VtxCurrentIdx += vertexCount;
+    }
 
   public:
 
@@ -40,6 +135,11 @@ namespace fr::Imgui {
       // Default grid line color is a fairly light gray
       _gridLineColor = IM_COL32(211,211,211,50);
       setBackgroundColor(0.27f, 0.31f, 0.33f, 1.0f);
+      _canvas = &_gridCanvas;
+      _edgeStore = &_gridEdges;
+      _gridEdges.setCanvas(&_gridCanvas);
+      _anchorIndex = &_gridAnchors;
+      _nodeHandles = &_gridHandles;
     }
 
     virtual ~GridWindow() {}
@@ -52,27 +152,75 @@ namespace fr::Imgui {
       _gridLineColor = IM_COL32(r,g,b,a);
     }
 
+    Canvas &canvas() {
+      return _gridCanvas;
+    }
+
+    EdgeStore &edges() {
+      return _gridEdges;
+    }
+
+    // Pans and zooms the canvas. Only looks at the mouse while it's
+    // over this window itself and not one of the node windows on it.
+    virtual void handleCanvasInput() {
+      if (!ImGui::IsWindowHovered()) {
+        return;
+      }
+      ImGuiIO &io = ImGui::GetIO();
+      if (ImGui::IsMouseDragging(ImGuiMouseButton_Right) || ImGui::IsMouseDragging(ImGuiMouseButton_Middle)) {
+        _gridCanvas.panBy(io.MouseDelta);
+      }
+      if (io.MouseWheel != 0.0f) {
+        _gridCanvas.zoomAt(io.MousePos, std::pow(wheelZoomStep, io.MouseWheel));
+      }
+    }
+
     virtual void drawGrid() {
+      FR_PROFILE_SCOPE("GridWindow::drawGrid");
       ImDrawList *drawList = ImGui::GetWindowDrawList();
 
-      for (float y = 0.0; y < _currentSize.y; y += _squareSize) {
-        drawList->AddLine(screenCoordinate(0, y), screenCoordinate(_currentSize.x, y), _gridLineColor);
+      // Only the part of the window that can actually be seen
+      ImVec2 clipMin = drawList->GetClipRectMin();
+      ImVec2 clipMax = drawList->GetClipRectMax();
+      GridGeometryKey key;
+      key.minX = std::floor(std::max(_min.x, clipMin.x));
+      key.minY = std::floor(std::max(_min.y, clipMin.y));
+      key.maxX = std::floor(std::min(_min.x + _currentSize.x, clipMax.x));
+      key.maxY = std::floor(std::min(_min.y + _currentSize.y, clipMax.y));
+      if (key.maxX <= key.minX || key.maxY <= key.minY) {
+        return;
       }
-      
-      for (float x = 0.0; x < _currentSize.x; x+= _squareSize) {
-        drawList->AddLine(screenCoordinate(x, 0), screenCoordinate(x, _currentSize.y), _gridLineColor);
+
+      key.spacing = _squareSize * _gridCanvas.zoom();
+      while (key.spacing < minimumGridSpacing) {
+        key.spacing *= 2.0f;
       }
-      
-      drawList->AddLine(screenCoordinate(0.0,0.0), screenCoordinate(0.0, _currentSize.y), _gridLineColor);
-      drawList->AddLine(screenCoordinate(0.0,0.0), screenCoordinate(_currentSize.x, 0.0), _gridLineColor);
-      drawList->AddLine(screenCoordinate(_currentSize.x, 0.0), screenCoordinate(_currentSize.x, _currentSize.y), _gridLineColor);
-      drawList->AddLine(screenCoordinate(0.0, _currentSize.y), screenCoordinate(_currentSize.x, _currentSize.y), _gridLineColor);
+      // Lines sit on canvas multiples of the square size, so the
+      // first one is the first multiple past the visible edge
+      ImVec2 origin = _gridCanvas.toScreen(ImVec2(0.0f, 0.0f));
+      key.startX = std::floor(origin.x + std::ceil((key.minX - origin.x) / key.spacing) * key.spacing);
+      key.startY = std::floor(origin.y + std::ceil((key.minY - origin.y) / key.spacing) * key.spacing);
+      key.color = _gridLineColor;
+      ImVec2 whitePixel = ImGui::GetFontTexUvWhitePixel();
+      key.u = whitePixel.x;
+      key.v = whitePixel.y;
+
+      if (!(key == _gridKey)) {
+        buildGrid(key);
+        _gridKey = key;
+      }
+      spliceGrid(drawList);
     }
 
-    void begin() override {
-      Parent::begin();
-
-      drawGrid();        
+    // The grid goes down before the children so nodes drawn as boxes
+    // on this window's draw list end up on top of it. Edges go last,
+    // once every anchor has been moved to where its window is.
+    void renderChildren() override {
+      handleCanvasInput();
+      drawGrid();
+      _gridAnchors.markHot(ImGui::GetIO().MousePos, anchorHotRadius, ImGui::GetFrameCount());
+      Parent::renderChildren();
+      _gridEdges.draw();
     }
 
     void end() override {
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace fr::Imgui {
+
+  /**
+   * Keeps imgui.ini from growing without bound. Node windows are
+   * named after their node's UUID, so ImGui writes a [Window] entry
+   * for every node anyone ever opened. The main loop turns off
+   * ImGui's own ini handling and goes through load() and save()
+   * instead, which keep every window used this session and only
+   * as many of the rest as fit under the cap, most recently used
+   * first.
+   *
+   * Windows tell us they're in use with touch(). Node windows also
+   * claim() their identity, so the same node open twice (two
+   * graphs loaded from the same file, say) doesn't end up as one
+   * ImGui window.
+   */
+
+  class IniSettings {
+    std::mutex _mutex;
+    // Identities of windows that are open right now
+    std::unordered_set<std::string> _live;
+    // Identities of windows used this session
+    std::unordered_set<std::string> _seen;
+    // Most [Window] entries load and save will keep
+    size_t _maxWindows;
+
+    IniSettings();
+
+    // Drops [Window] entries from ini text until no more than
+    // _maxWindows are left. Entries used this session go last and
+    // are never dropped, the rest go oldest first.
+    std::string prune(std::string_view ini);
+
+  public:
+    static constexpr size_t defaultMaxWindows = 1024;
+
+    static IniSettings &instance();
+
+    IniSettings(const IniSettings &) = delete;
+    IniSettings &operator=(const IniSettings &) = delete;
+
+    // The part of a window name ImGui builds its ID from. That's
+    // everything from "###" on if it has one, otherwise the whole
+    // name.
+    static std::string_view identity(std::string_view name);
+
+    // Marks identity as in use. Returns false if another open
+    // window already has it.
+    bool claim(const std::string &identity);
+    // Gives back an identity from claim()
+    void release(const std::string &identity);
+    // Marks a window name as used this session
+    void touch(std::string_view name);
+
+    void setMaxWindows(size_t maxWindows);
+
+    // Reads path, prunes it and hands it to ImGui. A missing file
+    // is fine, you just start with no settings.
+    void load(const char *path);
+    // Prunes ImGui's current settings and writes them to path
+    void save(const char *path);
+  };
+
+}
@@ -16,50 +16,48 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class InternationalAddressWindow : public NodeWindow {
+  class InternationalAddressWindow : public TypedNodeWindow<fr::RequirementsManager::InternationalAddress> {
     static const size_t countryCodeLen = 21;
     static const size_t localityLen = 201;
     static const size_t postalCodeLen = 51;
     char _countryCode[countryCodeLen];
     char _locality[localityLen];
     char _postalCode[postalCodeLen];
-    std::string _countryCodeLabel;
-    std::string _localityLabel;
-    std::string _postalCodeLabel;
+    const char *_countryCodeLabel;
+    const char *_localityLabel;
+    const char *_postalCodeLabel;
     std::string _addressLines;
-    std::string _addressLinesLabel;
+    const char *_addressLinesLabel;
 
   public:
     using Type = InternationalAddressWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::InternationalAddress>;
     using NodeType = fr::RequirementsManager::InternationalAddress;
 
     InternationalAddressWindow(const std::string &title = "International Address") : Parent(title) {
       memset(_countryCode, '\0', countryCodeLen);
       memset(_locality, '\0', localityLen);
       memset(_postalCode, '\0', postalCodeLen);
-      _countryCodeLabel = getUniqueLabel("##CountryCode");
-      _localityLabel = getUniqueLabel("##Locality");
-      _postalCodeLabel = getUniqueLabel("##PostalCode");
-      _addressLinesLabel = getUniqueLabel("##AddressLines");
+      _countryCodeLabel = "##CountryCode";
+      _localityLabel = "##Locality";
+      _postalCodeLabel = "##PostalCode";
+      _addressLinesLabel = "##AddressLines";
     }
 
     virtual ~InternationalAddressWindow() {
     }
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_countryCode, node->getCountryCode().c_str(), countryCodeLen - 1);
         strncpy(_locality, node->getLocality().c_str(), localityLen - 1);
@@ -69,27 +67,31 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{} {} {}", _addressLines, _locality, _postalCode, _countryCode));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         
         ImGui::Text("Country code: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_countryCodeLabel.c_str(),
+        if (ImGui::InputText(_countryCodeLabel,
                              _countryCode,
                              countryCodeLen - 1,
                              inputTextFlags)) {
           node->setCountryCode(_countryCode);
         }
         ImGui::Text("Address: ");
-        if (ImGui::InputTextMultiline(_addressLinesLabel.c_str(),
+        if (ImGui::InputTextMultiline(_addressLinesLabel,
                                       &_addressLines,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -97,7 +99,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("Locality: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_localityLabel.c_str(),
+        if (ImGui::InputText(_localityLabel,
                              _locality,
                              localityLen - 1,
                              inputTextFlags)) {
@@ -105,7 +107,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("Postal Code: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_postalCodeLabel.c_str(),
+        if (ImGui::InputText(_postalCodeLabel,
                              _postalCode,
                              postalCodeLen - 1,
                              inputTextFlags)) {
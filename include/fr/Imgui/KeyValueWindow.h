@@ -16,21 +16,22 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class KeyValueWindow : public NodeWindow {
+  class KeyValueWindow : public TypedNodeWindow<fr::RequirementsManager::KeyValue> {
     static const size_t keyLen = 201;
     char _keyText[keyLen];
-    std::string _keyLabel;
+    const char *_keyLabel;
     std::string _value;
-    std::string _valueLabel;
+    const char *_valueLabel;
 
     void setKeyValueText() {
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::KeyValue>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_keyText, node->getKey().c_str(), keyLen - 1);
         _value = node->getValue();
@@ -41,47 +42,48 @@ namespace fr::Imgui {
 
     using Type = KeyValueWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::KeyValue>;
     using NodeType = fr::RequirementsManager::KeyValue;
 
     KeyValueWindow(const std::string &title = "KeyValue") : Parent(title) {
       memset(_keyText, '\0', keyLen);
-      _keyLabel = getUniqueLabel("##Key");
-      _valueLabel = getUniqueLabel("##Value");
+      _keyLabel = "##Key";
+      _valueLabel = "##Value";
     }
 
     virtual ~KeyValueWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
+      ensureNode();
       setKeyValueText();
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{} = {}", _keyText, _value));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
 
         ImGui::Text("Key: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_keyLabel.c_str(),
+        if (ImGui::InputText(_keyLabel,
                              _keyText,
                              keyLen - 1,
                              inputTextFlags)) {
           node->setKey(_keyText);
         }
         ImGui::Text("Value:");
-        if (ImGui::InputTextMultiline(_valueLabel.c_str(),
+        if (ImGui::InputTextMultiline(_valueLabel,
                                       &_value,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
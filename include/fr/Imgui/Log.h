@@ -0,0 +1,181 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <thread>
+#include <utility>
+
+// Messages below this level compile out entirely. 0 is Trace, 5
+// turns off logging. Set with -DFR_LOG_LEVEL in CMake.
+#ifndef FR_LOG_LEVEL
+#define FR_LOG_LEVEL 2
+#endif
+
+namespace fr::Imgui {
+
+  enum class LogLevel : int {
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+  };
+
+  enum class LogCategory : int {
+    General = 0,
+    Anchor,
+    Factory,
+    Rest,
+    Db,
+    Count
+  };
+
+  /**
+   * Logger hands messages off to a background thread that writes them
+   * to stdout, so logging from the UI thread or a loader thread costs
+   * a format into a preallocated slot instead of a synchronous,
+   * flushed write. The slots are a bounded lock-free ring buffer
+   * (Vyukov's MPMC queue, with one consumer). If the writer falls
+   * behind and the ring fills up, messages get dropped and counted
+   * rather than blocking whoever is logging. The writer thread sleeps
+   * while the ring is empty, and only a publish that finds it asleep
+   * pays for waking it.
+   *
+   * Use the FR_LOG_* macros. They check the level at compile time
+   * against FR_LOG_LEVEL and at run time against the logger's level
+   * and category mask, and don't evaluate their arguments when the
+   * message won't be written.
+   */
+
+  class Logger {
+  public:
+    // Ring capacity, has to be a power of two
+    static constexpr size_t capacity = 4096;
+    // Longer messages get truncated
+    static constexpr size_t messageLen = 256;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+      std::atomic<size_t> sequence;
+      LogLevel level;
+      LogCategory category;
+      uint64_t nanos;
+      size_t length;
+      char text[messageLen];
+    };
+
+    std::unique_ptr<std::array<Slot, capacity>> _slots;
+    alignas(64) std::atomic<size_t> _enqueue;
+    alignas(64) size_t _dequeue;
+    // Set while the drain thread is waiting for something to write
+    std::atomic<bool> _sleeping;
+    std::atomic<int> _level;
+    std::atomic<uint32_t> _categories;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<bool> _running;
+    Clock::time_point _epoch;
+    std::thread _drainThread;
+
+    Logger();
+
+    // Claims the next slot for writing. Returns null if the ring is full.
+    Slot *claim(size_t &position);
+    void publish(Slot *slot, size_t position);
+    // Writes out everything that's been published. Drain thread only.
+    size_t drain();
+    // True if the next slot to drain has been published
+    bool ready() const;
+    void drainLoop();
+
+  public:
+    static Logger &instance();
+
+    ~Logger();
+
+    Logger(const Logger &) = delete;
+    Logger &operator=(const Logger &) = delete;
+
+    static const char *levelName(LogLevel level);
+    static const char *categoryName(LogCategory category);
+
+    bool enabled(LogLevel level, LogCategory category) const {
+      return static_cast<int>(level) >= _level.load(std::memory_order_relaxed) &&
+        (_categories.load(std::memory_order_relaxed) & (1u << static_cast<int>(category)));
+    }
+
+    // Run time level. Can't go below FR_LOG_LEVEL, those are compiled out.
+    void setLevel(LogLevel level) {
+      _level.store(std::max(static_cast<int>(level), FR_LOG_LEVEL), std::memory_order_relaxed);
+    }
+
+    void setCategoryEnabled(LogCategory category, bool enabled) {
+      uint32_t bit = 1u << static_cast<int>(category);
+      if (enabled) {
+        _categories.fetch_or(bit, std::memory_order_relaxed);
+      } else {
+        _categories.fetch_and(~bit, std::memory_order_relaxed);
+      }
+    }
+
+    // Messages lost to a full ring
+    uint64_t dropped() const {
+      return _dropped.load(std::memory_order_relaxed);
+    }
+
+    template <typename... Args>
+    void log(LogLevel level, LogCategory category, std::format_string<Args...> format, Args &&...args) {
+      size_t position;
+      Slot *slot = claim(position);
+      if (!slot) {
+        return;
+      }
+      slot->level = level;
+      slot->category = category;
+      slot->nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _epoch).count();
+      auto result = std::format_to_n(slot->text, messageLen, format, std::forward<Args>(args)...);
+      slot->length = std::min(static_cast<size_t>(result.size), messageLen);
+      publish(slot, position);
+    }
+  };
+
+}
+
+#define FR_LOG(level, category, ...)                                    \
+  do {                                                                  \
+    if constexpr (static_cast<int>(level) >= FR_LOG_LEVEL) {            \
+      auto &frLogger = ::fr::Imgui::Logger::instance();                 \
+      if (frLogger.enabled(level, category)) {                          \
+        frLogger.log(level, category, __VA_ARGS__);                     \
+      }                                                                 \
+    }                                                                   \
+  } while (0)
+
+#define FR_LOG_TRACE(category, ...) FR_LOG(::fr::Imgui::LogLevel::Trace, ::fr::Imgui::LogCategory::category, __VA_ARGS__)
+#define FR_LOG_DEBUG(category, ...) FR_LOG(::fr::Imgui::LogLevel::Debug, ::fr::Imgui::LogCategory::category, __VA_ARGS__)
+#define FR_LOG_INFO(category, ...) FR_LOG(::fr::Imgui::LogLevel::Info, ::fr::Imgui::LogCategory::category, __VA_ARGS__)
+#define FR_LOG_WARN(category, ...) FR_LOG(::fr::Imgui::LogLevel::Warn, ::fr::Imgui::LogCategory::category, __VA_ARGS__)
+#define FR_LOG_ERROR(category, ...) FR_LOG(::fr::Imgui::LogLevel::Error, ::fr::Imgui::LogCategory::category, __VA_ARGS__)
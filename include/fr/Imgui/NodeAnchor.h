@@ -82,9 +82,15 @@ namespace fr::Imgui {
     bool _hovered;
     // Indicates dragging is happening
     bool _dragging;
+    // Last frame the AnchorIndex found the mouse near this anchor
+    int _hotFrame;
+    // In the parent window's AnchorIndex
+    bool _indexed;
     // Parent node
     ImU32 _linkColor;
     fr::RequirementsManager::Node::PtrType _node;
+    // _node's handle in the editor's NodeHandles, once looked up
+    NodeHandle _handle;
 
     // Imgui doesn't seem to like passing shared pointers around
     // so I'm just going to hook into the drag/drop instrumentation
@@ -97,8 +103,19 @@ namespace fr::Imgui {
      * holds. You can make new ones in the GUI but when the nodes are
      * initally loaded, the existing connections will have to be
      * populated by some external (to this NodeAnchor) entity.
+     *
+     * Keyed by the handle of the node on the other end.
      */
-    std::unordered_map<std::string, std::shared_ptr<NodeDragPayload>> _connections;
+    std::unordered_map<NodeHandle, std::shared_ptr<NodeDragPayload>> _connections;
+
+    // The parent window's edge store, if it's in an editor that has one
+    EdgeStore *edgeStore();
+    // Same for the anchor index
+    AnchorIndex *anchorIndex();
+    // And the node handles
+    NodeHandles *nodeHandles();
+    // Reach of a link's control points at the parent canvas's zoom
+    float controlOffset();
     
   public:
 
@@ -117,7 +134,10 @@ namespace fr::Imgui {
       _bbsize(0,0),
       _hovered(false),
       _dragging(false),
-      _linkColor(_defaultLinkColor) {
+      _hotFrame(-1),
+      _indexed(false),
+      _linkColor(_defaultLinkColor),
+      _handle(invalidNodeHandle) {
     }
 
     virtual ~NodeAnchor() {}
@@ -126,10 +146,38 @@ namespace fr::Imgui {
     
     void setLinkColor(ImU32 color);
 
+    ImU32 getLinkColor() const {
+      return _linkColor;
+    }
+
     ImVec2 getCenter() {
       return _center;
     }
 
+    AnchorType getType() const {
+      return _type;
+    }
+
+    // Handle of the parent window's node. Connections are keyed on
+    // the handle of the anchor at the other end. invalidNodeHandle
+    // until the window is in an editor, and anchors without a handle
+    // can't be linked.
+    NodeHandle nodeHandle();
+
+    // True if the parent window is frozen (see NodeWindow::freeze)
+    bool frozen();
+
+    // True if this anchor already has a link to the node with handle
+    bool connectedTo(NodeHandle handle) const {
+      return _connections.contains(handle);
+    }
+
+    // The AnchorIndex calls this when the mouse is near the anchor.
+    // Only hot anchors and the one being dragged submit ImGui items.
+    void markHot(int frame) {
+      _hotFrame = frame;
+    }
+
     // Establish a connection with another NodeAnchor. When an
     // Imgui DragDropTarget payload is processed in begin,
     // the payload should be dropped into this anchor's
@@ -148,14 +196,21 @@ namespace fr::Imgui {
     // Remove a connection betrween two anchors
     void removeConnection(std::shared_ptr<NodeDragPayload> connection);
 
-    // Draw connections between nodes
+    // Drop every connection and take the anchor out of the edge store
+    // and anchor index, without touching the nodes. For closing a
+    // graph. Links hold the anchors on both ends, so anchors stay
+    // alive until this breaks them up.
+    void disconnectAll();
+
+    // Draw connections between nodes. Anchors in an editor with an
+    // EdgeStore leave this to the store and don't draw anything here.
     void drawConnections();
     
     void begin() override;
 
     void end() override;
 
-    // (Re)set center coordinate
+    // (Re)set center coordinate. Keeps the anchor index up to date.
     void setCenter(ImVec2 center);
     
   };
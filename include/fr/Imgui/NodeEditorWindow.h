@@ -21,11 +21,16 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <format>
 #include <fr/Imgui/AllWindows.h>
 #include <fr/Imgui/GridWindow.h>
+#include <fr/Imgui/ProfilerWindow.h>
 #include <fr/Imgui/RestLocator.h>
 #include <fr/Imgui/WindowFactory.h>
+#include <fr/Imgui/WindowTable.h>
 #include <fr/RequirementsManager/RestFactoryApi.h>
 #include <fr/types/Concepts.h>
 #include <fr/types/Typelist.h>
@@ -77,8 +82,15 @@ namespace fr::Imgui {
     float _squareSize;
     std::string _fileDialogLabel;
     ImVec2 _fileDialogSize;
+    // Every factory that creates windows in this editor. Their queued
+    // nodes get materialized a frame budget at a time at the start of
+    // each frame. Declared ahead of _factory so it outlives it.
+    std::vector<WindowFactory<WindowList> *> _windowFactories;
+    static const size_t progressTextLen = 64;
+    char _progressText[progressTextLen];
     fr::Imgui::WindowFactory<WindowList> _factory;
     std::shared_ptr<RestLocator<WindowList>> _restWindow;
+    std::shared_ptr<ProfilerWindow> _profilerWindow;
     // I need to pass this to any graph node windows I open so they can save
     // to REST. I get this from RestLocator (RestLocator sets it when
     // I call addEditorWindow)
@@ -113,9 +125,53 @@ namespace fr::Imgui {
       threadpool->startThreads(DEFAULT_THREADPOOL_SIZE);
 #endif
       _restWindow = std::make_shared<RestLocator<WindowList>>();
+      _profilerWindow = std::make_shared<ProfilerWindow>();
       _fileDialogLabel = getUniqueLabel("FileDialog");
       _fileDialogSize.x = 600;
       _fileDialogSize.y = 400;
+      memset(_progressText, '\0', progressTextLen);
+      _factory.addEditorWindow(this);
+    }
+
+    // WindowFactory::addEditorWindow calls this. Factories have to live
+    // as long as the editor does.
+    void addFactory(WindowFactory<WindowList> *factory) {
+      if (std::find(_windowFactories.begin(), _windowFactories.end(), factory) == _windowFactories.end()) {
+        _windowFactories.push_back(factory);
+      }
+    }
+
+    // True while any factory still has nodes to create windows for.
+    // The main loop keeps rendering while this is set.
+    bool loading() {
+      return std::any_of(_windowFactories.begin(), _windowFactories.end(),
+                         [](WindowFactory<WindowList> *factory) { return factory->loading(); });
+    }
+
+    // Close a graph one of our factories loaded. See
+    // WindowFactory::closeGraph.
+    bool closeGraph(GraphId id) {
+      for (auto factory : _windowFactories) {
+        if (factory->closeGraph(id)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Every graph open in the editor
+    std::vector<GraphInfo> graphs() {
+      std::vector<GraphInfo> all;
+      for (auto factory : _windowFactories) {
+        auto infos = factory->graphs();
+        all.insert(all.end(), infos.begin(), infos.end());
+      }
+      return all;
+    }
+
+    // The editor's own factory, for loading graphs into it directly
+    WindowFactory<WindowList> &factory() {
+      return _factory;
     }
 
     void setGraphNodeFactory(fr::RequirementsManager::GraphNodeFactory* factory) {
@@ -129,25 +185,23 @@ namespace fr::Imgui {
     template <typename List>
     requires fr::types::IsUnique<List>
     void buildMenus() {
-      using Rest = List::tail;
-      auto info = std::make_shared<ItemInfo>();
-      info->name = Registration::Record<typename List::head::type>::name;
-      info->create = [&]() {
-        Registration::createWindow<NodeEditorWindow, typename List::head::type>(*this);
-      };
-      
-      _menus[Registration::Record<typename List::head::type>::topMenuName].push_back(info);
-      if constexpr(!std::is_void_v<typename Rest::head::type>) {
-        buildMenus<Rest>();
+      // Same table WindowFactory creates loaded windows from
+      for (const Registration::WindowEntry &entry : Registration::WindowTable<List>::instance().entries()) {
+        auto info = std::make_shared<ItemInfo>();
+        info->name = entry.name;
+        info->create = [this, create = entry.create]() {
+          Registration::addWindow(*this, create(getGraphNodeFactory()));
+        };
+        _menus[entry.topMenuName].push_back(info);
       }
     }
 
     virtual ~NodeEditorWindow() {}
 
     void beginning() override {
-      _factory.addEditorWindow(this);
       _restWindow->addEditorWindow(this);
       this->add(getUniqueLabel("##RestWindow"), _restWindow);
+      this->add(getUniqueLabel("##ProfilerWindow"), _profilerWindow);
 #ifndef NO_SQL
       this->add(getUniqueLabel("##DatabaseFactory"), _databaseFactory);
       _databaseFactory->addEditorWindow(this);
@@ -158,11 +212,11 @@ namespace fr::Imgui {
     void Begin() override {
       // I always want my NodeEditorWindow behind all the other windows
       // and I want it to always fill the entire OS Window that ImGui creates
-      // as the background window.
+      // as the background window. It doesn't scroll, the mouse wheel
+      // zooms the canvas instead.
       auto flags = ImGuiWindowFlags_NoBringToFrontOnFocus |
         ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_MenuBar |
-        ImGuiWindowFlags_AlwaysVerticalScrollbar |
-        ImGuiWindowFlags_AlwaysHorizontalScrollbar;
+        ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse;
       ImVec2 displaySize = ImGui::GetMainViewport()->Size;
       ImGui::SetNextWindowSize(displaySize);
       ImGui::SetNextWindowPos(ImVec2(0, 0));
@@ -170,6 +224,21 @@ namespace fr::Imgui {
     }    
     
     void begin() override {
+      // Create windows for anything the factories have queued before
+      // the children render, so they show up this frame
+      size_t loaded = 0;
+      size_t toLoad = 0;
+      for (auto factory : _windowFactories) {
+        factory->materialize();
+        if (factory->loading()) {
+          size_t done;
+          size_t total;
+          factory->progress(done, total);
+          loaded += done;
+          toLoad += total;
+        }
+      }
+
       Parent::begin();
       if (ImGui::BeginMainMenuBar()) {
       
@@ -182,24 +251,46 @@ namespace fr::Imgui {
           }
 #endif
 #ifndef NO_LOAD_SAVE_JSON          
-          if (ImGui::MenuItem("Load from JSON")) {
-            ImGuiFileDialog::Instance()->OpenDialog(_fileDialogLabel, "Load From JSON", ".json");
+          if (ImGui::MenuItem("Load from File")) {
+            ImGuiFileDialog::Instance()->OpenDialog(_fileDialogLabel, "Load From File", graphFileFilters);
           }
 #endif
           if (ImGui::MenuItem("Query REST Service")) {
             _restWindow->setShow(true);
           }
+          bool anyGraphs = std::any_of(_windowFactories.begin(), _windowFactories.end(),
+                                       [](WindowFactory<WindowList> *factory) { return factory->hasGraphs(); });
+          if (ImGui::BeginMenu("Close Graph", anyGraphs)) {
+            for (const auto &graph : graphs()) {
+              if (ImGui::MenuItem(graph.name.c_str())) {
+                closeGraph(graph.id);
+              }
+            }
+            ImGui::EndMenu();
+          }
           if (ImGui::MenuItem("Exit")) {
             exitEvent();
           }
           
           ImGui::EndMenu();
         }
+
+        if (ImGui::BeginMenu("View")) {
+          if (ImGui::MenuItem("Reset Zoom")) {
+            _gridCanvas.reset();
+          }
+#ifndef NO_PROFILER
+          if (ImGui::MenuItem("Profiler", nullptr, _profilerWindow->getShow())) {
+            _profilerWindow->setShow(!_profilerWindow->getShow());
+          }
+#endif
+          ImGui::EndMenu();
+        }
         
         // Render Registration-based windows
-        for (auto [item, infoVec] : _menus) {
+        for (const auto &[item, infoVec] : _menus) {
           if (ImGui::BeginMenu(item.c_str())) {
-            for (auto info : infoVec) {
+            for (const auto &info : infoVec) {
               if (ImGui::MenuItem(info->name.c_str())) {
                 info->create();
               }
@@ -207,6 +298,31 @@ namespace fr::Imgui {
             ImGui::EndMenu();
           }
         }
+
+        // Progress for graphs that are still coming in
+#ifndef NO_LOAD_SAVE_JSON
+        for (auto factory : _windowFactories) {
+          for (const auto &load : factory->readingLoads()) {
+            ImGui::PushID(load.get());
+            snprintf(_progressText, progressTextLen, "Reading %s", load->name().c_str());
+            ImGui::ProgressBar(load->fraction(), ImVec2(250.0f, 0.0f), _progressText);
+            if (ImGui::SmallButton("Cancel")) {
+              load->cancel();
+            }
+            ImGui::PopID();
+          }
+        }
+#endif
+        if (toLoad > 0) {
+          snprintf(_progressText, progressTextLen, "Loading %zu / %zu nodes", loaded, toLoad);
+          ImGui::ProgressBar(static_cast<float>(loaded) / static_cast<float>(toLoad),
+                             ImVec2(250.0f, 0.0f), _progressText);
+          if (ImGui::SmallButton("Cancel##Loading")) {
+            for (auto factory : _windowFactories) {
+              factory->cancelLoading();
+            }
+          }
+        }
       }
       ImGui::EndMainMenuBar();
 
@@ -216,16 +332,9 @@ namespace fr::Imgui {
       if (ImGuiFileDialog::Instance()->Display(_fileDialogLabel, ImGuiWindowFlags_NoCollapse, _fileDialogSize, _fileDialogSize)) {
         if (ImGuiFileDialog::Instance()->IsOk()) {
           std::string filePathName = ImGuiFileDialog::Instance()->GetFilePathName();
-          std::shared_ptr<fr::RequirementsManager::Node> node;
-          
-          std::ifstream streamIn(filePathName);
-          {
-            cereal::JSONInputArchive archive(streamIn);
-            archive(node);
-          }
-          if (node) {
-            _factory.add(node);
-          }
+          // Parsed on the factory's threadpool. The windows come in a
+          // frame budget at a time once it's done.
+          _factory.loadGraph(filePathName);
         }
         ImGuiFileDialog::Instance()->Close();
       }
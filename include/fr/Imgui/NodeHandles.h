@@ -0,0 +1,121 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fr::RequirementsManager {
+  class Node;
+}
+
+namespace fr::Imgui {
+
+  class Window;
+
+  // Small dense number standing in for a node's UUID inside one editor
+  using NodeHandle = uint32_t;
+  // Never handed out. Anything without a node gets this.
+  constexpr NodeHandle invalidNodeHandle = 0;
+
+  // Identifies one graph given to a WindowFactory, for closing it
+  // later. Unique across factories.
+  using GraphId = uint32_t;
+  constexpr GraphId invalidGraphId = 0;
+
+  // What the editor's menus show about an open graph
+  struct GraphInfo {
+    GraphId id;
+    std::string name;
+  };
+
+  /**
+   * Interning table from node UUIDs to NodeHandles, one per editor.
+   * A node's UUID string gets hashed once, the first time the editor
+   * sees the node. After that anchors, factories and window lookups
+   * work with the handle, which indexes straight into a vector.
+   *
+   * Nodes are also looked up by address, which is how the factory
+   * finds a neighbor's handle without building its UUID string.
+   * Those entries hold a weak pointer so a node that's gone doesn't
+   * hand its handle to a new node at the same address.
+   *
+   * Every object with the same UUID shares one handle, like they
+   * share one window in the editor. Closing a graph releases its
+   * handles, forgetting every object interned under them, and new
+   * nodes get them again. UI thread only, like the rest of the
+   * rendering.
+   */
+
+  class NodeHandles {
+    using NodePtr = std::shared_ptr<fr::RequirementsManager::Node>;
+
+    struct Slot {
+      std::string uuid;
+      // Window showing the node in this editor, if it has one
+      std::weak_ptr<Window> window;
+      // Every address the node has been interned from. Usually one,
+      // more if the same node was loaded again.
+      std::vector<const fr::RequirementsManager::Node *> addresses;
+    };
+
+    struct Address {
+      std::weak_ptr<fr::RequirementsManager::Node> node;
+      NodeHandle handle;
+    };
+
+    // Indexed by handle. Slot 0 is invalidNodeHandle's.
+    std::vector<Slot> _slots;
+    std::unordered_map<std::string, NodeHandle> _byUuid;
+    std::unordered_map<const fr::RequirementsManager::Node *, Address> _byAddress;
+    // Released handles, handed out again before new ones
+    std::vector<NodeHandle> _free;
+
+  public:
+    NodeHandles();
+
+    // Handle for node, making one if it doesn't have one yet.
+    // Returns invalidNodeHandle for a null node.
+    NodeHandle intern(const NodePtr &node);
+
+    // Handle for node, or invalidNodeHandle if it hasn't been
+    // interned. Doesn't look at the UUID, just the address.
+    NodeHandle find(const NodePtr &node) const;
+
+    void setWindow(NodeHandle handle, std::shared_ptr<Window> window);
+
+    // Forget handle's nodes and window. The handle can be handed out
+    // again, so nothing should hang on to it after this.
+    void release(NodeHandle handle);
+
+    // Window for handle, or null if it doesn't have one
+    std::shared_ptr<Window> window(NodeHandle handle) const;
+
+    // UUID handle was made from. Empty for invalidNodeHandle.
+    const std::string &uuid(NodeHandle handle) const;
+
+    // Number of handles handed out and not released
+    size_t size() const {
+      return _slots.size() - 1 - _free.size();
+    }
+  };
+
+}
@@ -18,6 +18,7 @@
 
 #include <fteng/signals.hpp>
 #include <format>
+#include <fr/Imgui/GraphArena.h>
 #include <fr/Imgui/NodeAnchor.h>
 #include <fr/Imgui/Window.h>
 #include <fr/Imgui/Registration.h>
@@ -45,6 +46,8 @@ namespace fr::Imgui {
 
     // Max ID text len
     static constexpr size_t idTextLen = 51;
+    // Longest summary text shown at the Summary detail level
+    static constexpr size_t summaryLen = 160;
     // Default window title
     static constexpr char WindowTitle[] = "Node";
     
@@ -74,11 +77,91 @@ namespace fr::Imgui {
     char _idText[idTextLen];
 
     bool _initted;
-    // Window and Widget Labels
-    std::string _enableEditingLabel;
-    std::string _nodeIdLabel;
-    std::string _debugButtonLabel;
+    // Widget labels. These only need to be unique inside the window,
+    // so they're literals rather than getUniqueLabel strings.
+    const char *_enableEditingLabel;
+    const char *_nodeIdLabel;
+    const char *_debugButtonLabel;
+    // Length of the visible part of _label, ahead of the "##"
+    size_t _titleLength;
+    // Title strip color at the Box detail level. Picked from the
+    // title so each kind of node gets its own color.
+    ImU32 _boxColor;
+
+    // Where the window is on the canvas, in canvas coordinates.
+    // Only good once _placed is set, which happens the first time
+    // the window renders and ImGui gives it a position.
+    ImVec2 _canvasPos;
+    ImVec2 _canvasWindowSize;
+    ImVec2 _canvasContentSize;
+    bool _placed;
+    // Canvas version _min and _windowSize were last worked out for
+    uint64_t _canvasVersion;
+    // Set when the canvas moved the window and ImGui needs to be
+    // told before the next Begin
+    bool _reposition;
+    // Detail level the window rendered at last frame
+    DetailLevel _detail;
+    // Built from summary() when the window drops to Summary
+    std::string _summary;
+    // "###" plus the node's UUID, once claimed from IniSettings.
+    // Gives the window the same ImGui ID (and imgui.ini entry) every
+    // session. Empty if the node is open in another window too, in
+    // which case this one keeps its counter suffix.
+    std::string _identity;
+    // Number of freezes on the window and the editing state they
+    // put aside (see freeze)
+    int _frozen;
+    bool _editableBeforeFreeze;
+    bool _displayEditableBeforeFreeze;
     
+    // True if any part of the window was in the main viewport the
+    // last time it rendered. Windows that haven't rendered yet
+    // count as on screen, since we don't know their size.
+    bool onScreen();
+
+    // Draws the anchors' connections without rendering the window.
+    // Off-screen windows do this so edges to on-screen windows
+    // still show up. A no-op in editors with an EdgeStore, which
+    // draws every edge itself.
+    virtual void drawConnections();
+
+    // Puts the anchors on the window, given its top left corner in
+    // _min and the content size. Override to place extra anchors.
+    virtual void positionAnchors(ImVec2 contentSize);
+
+    // Works out _min and _windowSize from the canvas when the canvas
+    // has changed since the window last looked
+    void followCanvas();
+
+    // Records the window's canvas position after Begin. Picks up the
+    // first position ImGui gives the window and the user dragging or
+    // resizing it.
+    void updateCanvasPosition();
+
+    // Box detail level. A rectangle with the title on the parent's
+    // draw list, no ImGui window at all.
+    void drawBox();
+
+    // Summary detail level. A window with drawSummary in it instead
+    // of the editable widgets.
+    void renderSummary();
+
+    // Read-only contents of the window at the Summary detail level
+    virtual void drawSummary();
+
+    // A line or two about the node for the Summary detail level.
+    // Override to say something more useful than nothing.
+    virtual std::string summary() {
+      return std::string();
+    }
+
+    // Cuts text down to summaryLen for summary()
+    static std::string summarize(const std::string &text);
+
+    // Names the window after the node, see _identity
+    void claimIdentity();
+
     void setIdText() {
       std::string text = std::format("{}", _node->idString());
       strncpy(_idText, text.c_str(), idTextLen - 1);
@@ -100,7 +183,7 @@ namespace fr::Imgui {
     
     NodeWindow(const std::string& label = WindowTitle);
 
-    virtual ~NodeWindow() {}
+    virtual ~NodeWindow();
     
     // Add a node for this window to hold.
     // Making this virtual but it shouldn't ever
@@ -117,9 +200,41 @@ namespace fr::Imgui {
     // init on it.
     virtual void init();
 
+    // Unlinks the window from everything else in the editor so it
+    // can be freed once it's removed. Override to disconnect any
+    // extra anchors.
+    virtual void close();
+
     // Returns stored node id
     std::string idString();
 
+    // Turn editing and linking off while something on another thread
+    // is reading the node, like a background save. Freezes nest.
+    // thaw puts editing back the way it was once the last one is
+    // gone. UI thread only.
+    void freeze();
+    void thaw();
+
+    bool frozen() const {
+      return _frozen > 0;
+    }
+
+    // True if the window's controls may change the node. Anything
+    // that writes to the node has to check this, not just _editable.
+    bool editable() const {
+      return _editable && !frozen();
+    }
+
+    // Override and return false for windows that shouldn't be
+    // culled, like ones that can open dialogs or popups.
+    virtual bool cullable() {
+      return true;
+    }
+
+    // Skips the window entirely while it's off screen and picks a
+    // detail level from the canvas zoom when it's on screen.
+    void render() override;
+
     void beginning() override;
     void begin() override;
 
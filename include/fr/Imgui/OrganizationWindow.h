@@ -16,18 +16,18 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/Organization.h>
 
 namespace fr::Imgui {
 
-  class OrganizationWindow : public NodeWindow {
+  class OrganizationWindow : public TypedNodeWindow<fr::RequirementsManager::Organization> {
     static const size_t nameLen = 201;
     char _nameText[nameLen];
-    std::string _nameTextLabel;
+    const char *_nameTextLabel;
 
     void setName() {
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Organization>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_nameText, node->getName().c_str(), nameLen - 1);
       }
@@ -35,46 +35,52 @@ namespace fr::Imgui {
 
   public:
     using Type = OrganizationWindow;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Organization>;
     using PtrType = std::shared_ptr<Type>;
     using NodeType = fr::RequirementsManager::Organization;
 
     OrganizationWindow(std::string title = "Organization")
       : Parent(title) {
       memset(_nameText, '\0', nameLen);
-      _nameTextLabel = getUniqueLabel("##Name");
+      _nameTextLabel = "##Name";
     }
 
     virtual ~OrganizationWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::Organization>();
-        _node->init();
-      }
+      ensureNode();
       setName();
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_nameText);
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Organization>(_node);
+      auto node = _typedNode;
       auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
       if (node) {
         // Organization can be locked to prevent editing. Have this state
-        // track with _editable.
-        if (_editable) {
-          node->unlock();
+        // track with _editable. Locking writes to the node, so leave
+        // it alone while it's frozen.
+        if (!frozen()) {
+          if (_editable) {
+            node->unlock();
+          } else {
+            node->lock();
+          }
+          // Also force displayEditable to be true for Organizations
+          _displayEditable = true;
+        }
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
-        } else {
-          node->lock();          
         }
-        // Also force displayEditable to be true for Organizations
-        _displayEditable = true;
 
         ImGui::Text("Name: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_nameTextLabel.c_str(), _nameText, nameLen - 1, inputTextFlags)) {
+        if (ImGui::InputText(_nameTextLabel, _nameText, nameLen - 1, inputTextFlags)) {
           node->setName(_nameText);
         }
       }
@@ -16,41 +16,39 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 
 namespace fr::Imgui {
 
-  class PersonWindow : public NodeWindow {
+  class PersonWindow : public TypedNodeWindow<fr::RequirementsManager::Person> {
     // Both name lens
     static const size_t nameLen = 201;
-    std::string _firstNameLabel;
+    const char *_firstNameLabel;
     char _firstName[nameLen];
-    std::string _lastNameLabel;
+    const char *_lastNameLabel;
     char _lastName[nameLen];
 
   public:
     using Type = PersonWindow;
     using PtrType = std::shared_ptr<PtrType>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Person>;
     using NodeType = fr::RequirementsManager::Person;
 
     PersonWindow(const std::string &title = "Person") : Parent(title) {
       memset(_firstName, '\0', nameLen);
       memset(_lastName, '\0', nameLen);
-      _firstNameLabel = getUniqueLabel("##FirstName");
-      _lastNameLabel = getUniqueLabel("##LastName");
+      _firstNameLabel = "##FirstName";
+      _lastNameLabel = "##LastName";
     }
 
     virtual ~PersonWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
+      ensureNode();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_firstName, node->getFirstName().c_str(), nameLen - 1);
         strncpy(_lastName, node->getLastName().c_str(), nameLen - 1);
@@ -58,18 +56,22 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{} {}", _firstName, _lastName));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("First Name: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_firstNameLabel.c_str(),
+        if (ImGui::InputText(_firstNameLabel,
                              _firstName,
                              nameLen - 1,
                              inputTextFlags)) {
@@ -77,7 +79,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("Last Name: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_lastNameLabel.c_str(),
+        if (ImGui::InputText(_lastNameLabel,
                              _lastName,
                              nameLen - 1,
                              inputTextFlags)) {
@@ -16,12 +16,13 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 
 namespace fr::Imgui {
 
-  class PhoneNumberWindow : public NodeWindow {
+  class PhoneNumberWindow : public TypedNodeWindow<fr::RequirementsManager::PhoneNumber> {
     static const size_t countryCodeLen = 11;
     static const size_t numberLen = 21;
     static const size_t typeLen = 21;
@@ -29,33 +30,30 @@ namespace fr::Imgui {
     char _countryCode[countryCodeLen];
     char _number[numberLen];
     char _phoneType[typeLen];
-    std::string _countryCodeLabel;
-    std::string _numberLabel;
-    std::string _phoneTypeLabel;
+    const char *_countryCodeLabel;
+    const char *_numberLabel;
+    const char *_phoneTypeLabel;
 
   public:
     using Type = PhoneNumberWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::PhoneNumber>;
     using NodeType = fr::RequirementsManager::PhoneNumber;
 
     PhoneNumberWindow(const std::string &title = "Phone Number") : Parent(title) {
       memset(_countryCode, '\0', countryCodeLen);
       memset(_number, '\0', numberLen);
       memset(_phoneType, '\0', typeLen);
-      _countryCodeLabel = getUniqueLabel("##CountryCode");
-      _numberLabel = getUniqueLabel("##Number");
-      _phoneTypeLabel = getUniqueLabel("##PhoneType");
+      _countryCodeLabel = "##CountryCode";
+      _numberLabel = "##Number";
+      _phoneTypeLabel = "##PhoneType";
     }
 
     virtual ~PhoneNumberWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_countryCode, node->getCountryCode().c_str(), countryCodeLen - 1);
         strncpy(_number, node->getNumber().c_str(), numberLen - 1);
@@ -64,19 +62,23 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("+{} {} ({})", _countryCode, _number, _phoneType));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Country Code: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_countryCodeLabel.c_str(),
+        if (ImGui::InputText(_countryCodeLabel,
                              _countryCode,
                              countryCodeLen - 1,
                              inputTextFlags)) {
@@ -84,7 +86,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("Number: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_numberLabel.c_str(),
+        if (ImGui::InputText(_numberLabel,
                              _number,
                              numberLen - 1,
                              inputTextFlags)) {
@@ -94,7 +96,7 @@ namespace fr::Imgui {
         ImGui::SameLine();
         // TODO: Check around and see if someone's implemented a
         // edit box with suggestions.
-        if (ImGui::InputText(_phoneTypeLabel.c_str(),
+        if (ImGui::InputText(_phoneTypeLabel,
                              _phoneType,
                              typeLen - 1,
                              inputTextFlags)) {
@@ -17,39 +17,37 @@
 #pragma once
 
 #include <fr/RequirementsManager/Product.h>
+#include <format>
 #include <fr/Imgui/CommitableNodeWindow.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class ProductWindow : public CommitableNodeWindow {
+  class ProductWindow : public TypedNodeWindow<fr::RequirementsManager::Product, CommitableNodeWindow> {
     static const size_t titleLen = 201;
     char _titleText[titleLen];
-    std::string _titleLabel;
-    std::string _descriptionLabel;
+    const char *_titleLabel;
+    const char *_descriptionLabel;
     std::string _description;
 
   public:
 
     using Type = ProductWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = CommitableNodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Product, CommitableNodeWindow>;
     using NodeType = fr::RequirementsManager::Product;
 
     ProductWindow(std::string title = "Product") : Parent(title) {
       memset(_titleText, '\0', titleLen);
-      _titleLabel = getUniqueLabel("##Title");
-      _descriptionLabel = getUniqueLabel("##Description");
+      _titleLabel = "##Title";
+      _descriptionLabel = "##Description";
     }
 
     virtual ~ProductWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::Product>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Product>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_titleText, node->getTitle().c_str(), titleLen - 1);
         _description = node->getDescription();
@@ -57,23 +55,27 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{}", _titleText, _description));
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Product>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable && !node->isCommitted()) {
+        if (editable() && !node->isCommitted()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
 
         ImGui::Text("Title: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_titleLabel.c_str(), _titleText, titleLen - 1, inputTextFlags)) {
+        if (ImGui::InputText(_titleLabel, _titleText, titleLen - 1, inputTextFlags)) {
           node->setTitle(_titleText);
         }
         ImGui::Text("Product Description:");
-        if (ImGui::InputTextMultiline(_descriptionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_descriptionLabel,
                                       &_description,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
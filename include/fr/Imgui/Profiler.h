@@ -0,0 +1,239 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace fr::Imgui {
+
+  /**
+   * One timed scope. Names are expected to be string literals, so
+   * the profiler just stores the pointer.
+   */
+
+  struct ProfileSample {
+    const char *name;
+    // Nanoseconds since the profiler was created
+    uint64_t start;
+    uint64_t duration;
+    uint32_t thread;
+    // Nesting depth of the scope on its thread
+    uint32_t depth;
+  };
+
+  struct ProfileCounter {
+    const char *name;
+    int64_t value;
+  };
+
+  /**
+   * A scope that runs once per window or anchor, added up over the
+   * frame instead of kept sample by sample
+   */
+
+  struct ProfileTotal {
+    const char *name;
+    uint64_t calls;
+    uint64_t duration;
+    uint64_t max;
+  };
+
+  /**
+   * Everything recorded between a beginFrame/endFrame pair
+   */
+
+  struct ProfileFrame {
+    uint64_t number = 0;
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    std::vector<ProfileSample> samples;
+    std::vector<ProfileCounter> counters;
+    std::vector<ProfileTotal> totals;
+  };
+
+  /**
+   * Profiler keeps the last frameHistory frames of scoped timer
+   * samples and counters in a ring buffer. It's off until someone
+   * enables it, and when it's off a scope costs one relaxed atomic
+   * load. Samples can come from any thread (WindowFactory runs on
+   * loader threads) and land in whatever frame is currently open.
+   *
+   * Scopes that run per window or per anchor would be hundreds of
+   * thousands of samples a frame on a big graph, so they use
+   * FR_PROFILE_TOTAL instead. Those add up in a per-thread table
+   * without taking the lock, and the table goes into the frame when
+   * its thread next records a sample, ends the frame, calls
+   * flushTotals or exits.
+   *
+   * Use the FR_PROFILE_SCOPE, FR_PROFILE_TOTAL and FR_PROFILE_COUNT
+   * macros rather than calling this directly, so the instrumentation
+   * compiles out when NO_PROFILER is defined.
+   */
+
+  class Profiler {
+  public:
+    static constexpr size_t frameHistory = 120;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<bool> _enabled;
+    Clock::time_point _epoch;
+    std::mutex _mutex;
+    std::array<ProfileFrame, frameHistory> _frames;
+    // Index of the frame currently being recorded
+    size_t _current;
+    // Number of finished frames in the ring
+    size_t _completed;
+    uint64_t _frameNumber;
+
+    Profiler();
+
+  public:
+    static Profiler &instance();
+
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    bool enabled() const {
+      return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled);
+
+    // Nanoseconds since the profiler was created
+    uint64_t now() const {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _epoch).count();
+    }
+
+    // Call at the start and end of every frame in the main loop
+    void beginFrame();
+    void endFrame();
+
+    void record(const char *name, uint64_t start, uint64_t duration, uint32_t depth);
+    void count(const char *name, int64_t delta);
+    // Adds to this thread's total for name. Doesn't lock.
+    void total(const char *name, uint64_t duration);
+    // Moves this thread's totals into the current frame
+    void flushTotals();
+
+    // Copies the most recently finished frame into frame. Reuses
+    // frame's storage, so call it with the same object every time.
+    // Returns false if no frame has finished yet.
+    bool lastFrame(ProfileFrame &frame);
+
+    // Copies the durations of the finished frames, oldest first,
+    // in milliseconds
+    void frameTimes(std::vector<float> &times);
+
+    // Drop everything recorded so far
+    void clear();
+
+    // Write the finished frames in Chrome trace-event JSON format
+    // (load it in chrome://tracing or https://ui.perfetto.dev)
+    void writeChromeTrace(std::ostream &out);
+  };
+
+  /**
+   * RAII timer that records a sample when it goes out of scope
+   */
+
+  class ProfileScope {
+    const char *_name;
+    uint64_t _start;
+    bool _active;
+    static thread_local uint32_t _depth;
+
+  public:
+    explicit ProfileScope(const char *name) : _name(name), _start(0) {
+      Profiler &profiler = Profiler::instance();
+      _active = profiler.enabled();
+      if (_active) {
+        _start = profiler.now();
+        ++_depth;
+      }
+    }
+
+    ~ProfileScope() {
+      if (_active) {
+        --_depth;
+        Profiler &profiler = Profiler::instance();
+        profiler.record(_name, _start, profiler.now() - _start, _depth);
+      }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+  };
+
+  /**
+   * RAII timer that adds to its name's total for the frame when it
+   * goes out of scope
+   */
+
+  class ProfileTotalScope {
+    const char *_name;
+    uint64_t _start;
+    bool _active;
+
+  public:
+    explicit ProfileTotalScope(const char *name) : _name(name), _start(0) {
+      Profiler &profiler = Profiler::instance();
+      _active = profiler.enabled();
+      if (_active) {
+        _start = profiler.now();
+      }
+    }
+
+    ~ProfileTotalScope() {
+      if (_active) {
+        Profiler &profiler = Profiler::instance();
+        profiler.total(_name, profiler.now() - _start);
+      }
+    }
+
+    ProfileTotalScope(const ProfileTotalScope &) = delete;
+    ProfileTotalScope &operator=(const ProfileTotalScope &) = delete;
+  };
+
+}
+
+#ifndef NO_PROFILER
+#define FR_PROFILE_CONCAT_INNER(a, b) a##b
+#define FR_PROFILE_CONCAT(a, b) FR_PROFILE_CONCAT_INNER(a, b)
+#define FR_PROFILE_SCOPE(name) \
+  ::fr::Imgui::ProfileScope FR_PROFILE_CONCAT(frProfileScope, __LINE__)(name)
+#define FR_PROFILE_TOTAL(name) \
+  ::fr::Imgui::ProfileTotalScope FR_PROFILE_CONCAT(frProfileTotal, __LINE__)(name)
+#define FR_PROFILE_COUNT(name, delta)                       \
+  do {                                                      \
+    auto &frProfiler = ::fr::Imgui::Profiler::instance();   \
+    if (frProfiler.enabled()) {                             \
+      frProfiler.count(name, delta);                        \
+    }                                                       \
+  } while (0)
+#else
+#define FR_PROFILE_SCOPE(name) do {} while (0)
+#define FR_PROFILE_TOTAL(name) do {} while (0)
+#define FR_PROFILE_COUNT(name, delta) do {} while (0)
+#endif
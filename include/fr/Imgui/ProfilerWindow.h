@@ -0,0 +1,211 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <fr/Imgui/Profiler.h>
+#include <fr/Imgui/Window.h>
+#include <fstream>
+#include <imgui.h>
+#include <vector>
+
+namespace fr::Imgui {
+
+  /**
+   * Overlay that shows what the Profiler recorded for the last frame.
+   * Scopes are rolled up by name so you can see which pass is eating
+   * the frame, and the whole ring buffer can be written out as a
+   * Chrome trace for a closer look.
+   */
+
+  class ProfilerWindow : public Window {
+    // Same _show/_displayWindow dance as RestLocator so ImGui closing
+    // the window doesn't get the frames out of sync
+    bool _show;
+    bool _displayWindow;
+    bool _enabled;
+
+    static const size_t tracePathLen = 301;
+    char _tracePath[tracePathLen];
+    std::string _traceStatus;
+
+    // One row in the scope table
+    struct Row {
+      const char *name;
+      size_t calls;
+      double totalMs;
+      double maxMs;
+    };
+
+    // These are reused every frame so the overlay doesn't allocate
+    // once it has warmed up
+    ProfileFrame _frame;
+    std::vector<Row> _rows;
+    std::vector<float> _frameTimes;
+
+    void summarize() {
+      _rows.clear();
+      for (const auto &sample : _frame.samples) {
+        double ms = sample.duration / 1000000.0;
+        auto row = std::find_if(_rows.begin(), _rows.end(), [&](const Row &r) {
+          return r.name == sample.name || strcmp(r.name, sample.name) == 0;
+        });
+        if (row == _rows.end()) {
+          _rows.push_back(Row{sample.name, 1, ms, ms});
+        } else {
+          row->calls++;
+          row->totalMs += ms;
+          row->maxMs = std::max(row->maxMs, ms);
+        }
+      }
+      // Per-window scopes come in already added up
+      for (const auto &total : _frame.totals) {
+        _rows.push_back(Row{total.name, total.calls, total.duration / 1000000.0, total.max / 1000000.0});
+      }
+      std::sort(_rows.begin(), _rows.end(), [](const Row &a, const Row &b) {
+        return a.totalMs > b.totalMs;
+      });
+    }
+
+  public:
+    using Type = ProfilerWindow;
+    using PtrType = std::shared_ptr<Type>;
+    using Parent = Window;
+
+    ProfilerWindow(const std::string &label = "Profiler") : Parent(label),
+                                                            _show(false),
+                                                            _displayWindow(false) {
+      _enabled = Profiler::instance().enabled();
+      memset(_tracePath, '\0', tracePathLen);
+      strncpy(_tracePath, "GraphEditorTrace.json", tracePathLen - 1);
+      setStartingSize(450, 500);
+    }
+
+    virtual ~ProfilerWindow() {}
+
+    void setShow(bool show) {
+      _show = show;
+      _displayWindow = show;
+    }
+
+    bool getShow() {
+      return _show;
+    }
+
+    void Begin() override {
+      if (_displayWindow) {
+        ImGui::Begin(_label.c_str(), &_show);
+      }
+    }
+
+    void begin() override {
+      if (!_displayWindow) {
+        return;
+      }
+      Parent::begin();
+
+      if (ImGui::Checkbox("Record", &_enabled)) {
+        Profiler::instance().setEnabled(_enabled);
+      }
+      ImGui::SameLine();
+      if (ImGui::Button("Clear")) {
+        Profiler::instance().clear();
+      }
+
+      Profiler::instance().frameTimes(_frameTimes);
+      if (!_frameTimes.empty()) {
+        ImGui::PlotLines("##FrameTimes", _frameTimes.data(), static_cast<int>(_frameTimes.size()),
+                         0, "Frame ms", 0.0f, FLT_MAX, ImVec2(0, 60));
+      }
+
+      if (Profiler::instance().lastFrame(_frame)) {
+        summarize();
+        ImGui::Text("Frame %llu: %.3f ms, %d samples",
+                    static_cast<unsigned long long>(_frame.number),
+                    _frame.duration / 1000000.0,
+                    static_cast<int>(_frame.samples.size()));
+
+        if (ImGui::BeginTable("##Scopes", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+          ImGui::TableSetupColumn("Scope");
+          ImGui::TableSetupColumn("Calls");
+          ImGui::TableSetupColumn("Total ms");
+          ImGui::TableSetupColumn("Max ms");
+          ImGui::TableHeadersRow();
+          for (const auto &row : _rows) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(row.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", row.calls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row.totalMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row.maxMs);
+          }
+          ImGui::EndTable();
+        }
+
+        if (!_frame.counters.empty() && ImGui::BeginTable("##Counters", 2, ImGuiTableFlags_Borders)) {
+          ImGui::TableSetupColumn("Counter");
+          ImGui::TableSetupColumn("Value");
+          ImGui::TableHeadersRow();
+          for (const auto &counter : _frame.counters) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(counter.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%lld", static_cast<long long>(counter.value));
+          }
+          ImGui::EndTable();
+        }
+      } else {
+        ImGui::TextUnformatted("No frames recorded yet. Check \"Record\" to start.");
+      }
+
+#ifndef __EMSCRIPTEN__
+      ImGui::Separator();
+      ImGui::Text("Trace file: ");
+      ImGui::SameLine();
+      ImGui::InputText("##TracePath", _tracePath, tracePathLen - 1);
+      if (ImGui::Button("Save Chrome Trace")) {
+        std::ofstream out(_tracePath);
+        if (out) {
+          Profiler::instance().writeChromeTrace(out);
+          _traceStatus = "Wrote trace";
+        } else {
+          _traceStatus = "Could not open trace file";
+        }
+      }
+      if (!_traceStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextUnformatted(_traceStatus.c_str());
+      }
+#endif
+    }
+
+    void end() override {
+      if (_displayWindow) {
+        Parent::end();
+        _displayWindow = _show;
+      }
+    }
+
+  };
+
+}
@@ -16,39 +16,37 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/Project.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class ProjectWindow : public NodeWindow {
+  class ProjectWindow : public TypedNodeWindow<fr::RequirementsManager::Project> {
     static const size_t nameLen = 201;
     char _nameText[nameLen];
-    std::string _nameLabel;
-    std::string _descriptionLabel;
+    const char *_nameLabel;
+    const char *_descriptionLabel;
     std::string _description;
 
   public:
     using Type = ProjectWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Project>;
     using NodeType = fr::RequirementsManager::Project;
 
     ProjectWindow(std::string title = "Project") : Parent(title) {
       memset(_nameText, '\0', nameLen);
-      _nameLabel = getUniqueLabel("##Name");
-      _descriptionLabel = getUniqueLabel("##Description");      
+      _nameLabel = "##Name";
+      _descriptionLabel = "##Description";      
     }
 
     virtual ~ProjectWindow() {};
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::Project>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Project>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_nameText, node->getName().c_str(), nameLen - 1);
         _description = node->getDescription();
@@ -56,25 +54,29 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{}", _nameText, _description));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Project>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Project Name:");
         ImGui::SameLine();
-        if (ImGui::InputText(_nameLabel.c_str(),
+        if (ImGui::InputText(_nameLabel,
                              _nameText,
                              nameLen - 1,
                              inputTextFlags)) {
           node->setName(_nameText);
         }
         ImGui::Text("Project Description:");
-        if (ImGui::InputTextMultiline(_descriptionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_descriptionLabel,
                                       &_description,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
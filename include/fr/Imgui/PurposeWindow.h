@@ -24,47 +24,45 @@
 #include <chrono>
 #include <ctime>
 #include <format>
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 #include <time.h>
 
 namespace fr::Imgui {
 
-  class PurposeWindow : public NodeWindow {
+  class PurposeWindow : public TypedNodeWindow<fr::RequirementsManager::Purpose> {
     static const size_t confidenceLen = 201;
     char _confidence[confidenceLen];
-    std::string _confidenceLabel;
+    const char *_confidenceLabel;
     std::string _description;
-    std::string _descriptionLabel;
-    std::string _deadlineLabel;
+    const char *_descriptionLabel;
+    const char *_deadlineLabel;
     time_t _deadline;
     tm _tmDeadline;
+    static const size_t dateTextLen = 32;
+    char _deadlineText[dateTextLen];
 
   public:
     using Type = PurposeWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Purpose>;
     using NodeType = fr::RequirementsManager::Purpose;
 
     PurposeWindow(const std::string &title = "Purpose") : Parent(title) {
       memset(_confidence, '\0', confidenceLen);
-      _confidenceLabel = getUniqueLabel("##Confidence");
-      _descriptionLabel = getUniqueLabel("##Description");
-      _deadlineLabel = getUniqueLabel("##Deadline");
+      memset(_deadlineText, '\0', dateTextLen);
+      _confidenceLabel = "##Confidence";
+      _descriptionLabel = "##Description";
+      _deadlineLabel = "##Deadline";
     }
 
     virtual ~PurposeWindow() {}
 
     void init() override {
-      bool inittedNode = false;
-      if (!_node) {
-        inittedNode = true;
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
+      bool inittedNode = ensureNode();
       
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_confidence, node->getDeadlineConfidence().c_str(), confidenceLen - 1);
         _description = node->getDescription();
@@ -75,35 +73,46 @@ namespace fr::Imgui {
           _deadline = node->getDeadline();
         }
         _tmDeadline = *std::gmtime(&_deadline);
+        std::strftime(_deadlineText, dateTextLen, "%F", &_tmDeadline);
       }
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\nDeadline: {}", _description, _deadlineText));
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Description:");
-        if (ImGui::InputTextMultiline(_descriptionLabel.c_str(),
+        if (ImGui::InputTextMultiline(_descriptionLabel,
                                       &_description,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
           node->setDescription(_description);          
         }
         ImGui::Text("Deadline:");
-        if (ImGui::DatePicker(_deadlineLabel.c_str(), _tmDeadline)) {
-          _deadline = std::mktime(&_tmDeadline);
-          // This is an actual date in the POSIX epoch, we're not
-          // deltaing this from when it's started.
-          node->setDeadline(_deadline);
+        if (editable()) {
+          if (ImGui::DatePicker(_deadlineLabel, _tmDeadline)) {
+            _deadline = std::mktime(&_tmDeadline);
+            // This is an actual date in the POSIX epoch, we're not
+            // deltaing this from when it's started.
+            node->setDeadline(_deadline);
+            std::strftime(_deadlineText, dateTextLen, "%F", &_tmDeadline);
+          }
+        } else {
+          ImGui::SameLine();
+          ImGui::TextUnformatted(_deadlineText);
         }
         ImGui::Text("Deadline Confidence: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_confidenceLabel.c_str(),
+        if (ImGui::InputText(_confidenceLabel,
                              _confidence,
                              confidenceLen - 1,
                              inputTextFlags)) {
@@ -94,27 +94,18 @@ namespace fr::Imgui::Registration {
   };
 
   /**
-   * createWindow creates a window of WindowType and adds it
-   * to an Editor of EditorType.
+   * addWindow adds a window made for the menus (see newWindow in
+   * WindowTable.h) to an Editor of EditorType and gives its node a
+   * handle in the editor.
    */
 
-  template <typename EditorType, typename WindowType>
-  requires has_init<WindowType> && has_add<EditorType>
-  void createWindow(EditorType& editor) {    
-    auto window = std::make_shared<WindowType>();
-    window->init();
-    // Graph windows need to have their GraphNodeFactory set so they can
-    // save to REST
-    // TODO: I really should probably just add editor as a parameter to
-    // Record<WindowType>::init and call it in the window init for windows
-    // that need it. There will probably be others.
-    if constexpr(std::is_same_v<GraphNodeWindow,WindowType>) {
-      window->setFactory(editor.getGraphNodeFactory());
-    }
-    auto startingSize = fr::Imgui::Registration::Record<WindowType>::startingSize();
-    window->setStartingSize(startingSize.x, startingSize.y);
-    fr::Imgui::Registration::Record<WindowType>::init(window);
+  template <typename EditorType, typename WindowPtr>
+  requires has_add<EditorType>
+  void addWindow(EditorType& editor, const WindowPtr& window) {
     editor.add(window->idString(), window);
+    if (auto handles = editor.getNodeHandles()) {
+      handles->setWindow(handles->intern(window->getNode()), window);
+    }
   }
 
     
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace fr::Imgui {
+
+  /**
+   * Lets work finishing on other threads wake up a main loop that's
+   * sleeping until there's something to draw. The main loop installs
+   * a waker (GraphEditor pushes an SDL event) and checks consume()
+   * each time around. Anything that changes what the UI would draw
+   * from off the UI thread, like a factory queueing nodes, should
+   * call request().
+   *
+   * With no waker installed request() just sets the flag, which is
+   * all a loop that renders every frame needs.
+   */
+
+  class RenderWake {
+    std::atomic<bool> _requested;
+    std::mutex _wakerMutex;
+    std::function<void()> _waker;
+
+    RenderWake();
+
+  public:
+    static RenderWake &instance();
+
+    RenderWake(const RenderWake &) = delete;
+    RenderWake &operator=(const RenderWake &) = delete;
+
+    // Called on request() from whatever thread made the request.
+    // Has to be thread safe and shouldn't block.
+    void setWaker(std::function<void()> waker);
+
+    // Ask for at least one more frame. Safe from any thread.
+    // Requests made before the loop gets around to consume() are
+    // collapsed into one wakeup.
+    void request();
+
+    // Returns true if a frame was requested since the last call
+    bool consume();
+  };
+
+}
@@ -17,48 +17,46 @@
 #pragma once
 
 #include <fr/RequirementsManager/Requirement.h>
+#include <format>
 #include <fr/Imgui/CommitableNodeWindow.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class RequirementWindow : public CommitableNodeWindow {
+  class RequirementWindow : public TypedNodeWindow<fr::RequirementsManager::Requirement, CommitableNodeWindow> {
     static const size_t titleLen = 201;
     char _titleText[titleLen];
-    std::string _titleLabel;
-    std::string _textLabel;
+    const char *_titleLabel;
+    const char *_textLabel;
     std::string _text;
-    std::string _functionalLabel;
+    const char *_functionalLabel;
     bool _functional;
 
   public:
 
     using Type = RequirementWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = CommitableNodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Requirement, CommitableNodeWindow>;
     using NodeType = fr::RequirementsManager::Requirement;
 
     RequirementWindow(const std::string &title = "Requirement") : Parent(title) {
       _functional = false;
       memset(_titleText, '\0', titleLen);
-      _titleLabel = getUniqueLabel("##Title");
-      _textLabel = getUniqueLabel("##Text");
-      _functionalLabel = getUniqueLabel("##Functional");      
+      _titleLabel = "##Title";
+      _textLabel = "##Text";
+      _functionalLabel = "##Functional";      
     }
 
     virtual ~RequirementWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
+      ensureNode();
 
       Parent::init();
     }
 
     void beginning() override {
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_titleText, node->getTitle().c_str(), titleLen - 1);
         _text = node->getText();
@@ -67,34 +65,38 @@ namespace fr::Imgui {
       Parent::beginning();
     }
     
+    std::string summary() override {
+      return summarize(std::format("{}\n{}", _titleText, _text));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable && !node->isCommitted()) {
+        if (editable() && !node->isCommitted()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Functional: ");
         ImGui::SameLine();
-        if (ImGui::Checkbox(_functionalLabel.c_str(), &_functional)) {
-          if (_editable && !node->isCommitted()) {
-            node->setFunctional(_functional);
-          }
+        ImGui::BeginDisabled(!editable() || node->isCommitted());
+        if (ImGui::Checkbox(_functionalLabel, &_functional)) {
+          node->setFunctional(_functional);
         }
+        ImGui::EndDisabled();
 
         ImGui::Text("Title: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_titleLabel.c_str(),
+        if (ImGui::InputText(_titleLabel,
                              _titleText,
                              titleLen - 1,
                              inputTextFlags)) {
           node->setTitle(_titleText);
         }
         ImGui::Text("Requirement Text:");
-        if (ImGui::InputTextMultiline(_textLabel.c_str(),
+        if (ImGui::InputTextMultiline(_textLabel,
                                       &_text,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -19,6 +19,8 @@
 #include <fteng/signals.hpp>
 #include <fr/RequirementsManager/RestFactoryApi.h>
 #include <fr/Imgui/AllWindows.h>
+#include <fr/Imgui/Log.h>
+#include <fr/Imgui/RenderWake.h>
 #include <fr/Imgui/Window.h>
 #include <fr/Imgui/WindowFactory.h>
 #include <mutex>
@@ -83,46 +85,48 @@ namespace fr::Imgui {
     // Store the server locator nodes for the graphs we can load
     std::vector<std::shared_ptr<fr::RequirementsManager::ServerLocatorNode>> _graphs;
     
-    // Labels for various controls
+    // Labels for various controls. ImGui scopes these to this
+    // window, so they're literals rather than getUniqueLabel strings.
 
     char _url[urlLen];
-    std::string _urlLabel;
+    const char *_urlLabel;
 
     // Label for the text box to input the server URL into
-    std::string _serverInputLabel;
+    const char *_serverInputLabel;
     // Label to refresh the contents of the window
-    std::string _refreshButtonLabel;
+    const char *_refreshButtonLabel;
     // Label to display if the backing factories don't
     // actually do anything
     std::string _noFactoriesLabel;
     // Text label to store error messages in
     std::string _errorMessage;
     // Label for our loading table
-    std::string _tableLabel;
+    const char *_tableLabel;
     // Column names
-    std::string _uuidColumn;
-    std::string _titleColumn;
-    std::string _loadColumn;
+    const char *_uuidColumn;
+    const char *_titleColumn;
+    const char *_loadColumn;
     
     void subscribe() {
       auto locatorAvailableSub =
         _locatorFactory.available.connect([&](std::shared_ptr<fr::RequirementsManager::ServerLocatorNode> node) {
           std::lock_guard<std::mutex> lock(_graphsMutex);
-          std::cout << "locator pushing back " << node->idString() << std::endl;
+          FR_LOG_DEBUG(Rest, "Locator pushing back {}", node->idString());
           _graphs.push_back(node);
+          RenderWake::instance().request();
       });
       auto displayGraphSub =
         _graphFactory.available.connect([&](std::shared_ptr<fr::RequirementsManager::Node> node) {
-          std::cout << "Creating windows for " << node->idString() << std::endl;
+          FR_LOG_INFO(Rest, "Creating windows for {}", node->idString());
           _windowFactory->add(node);
         });
       auto locatorFailSub =
         _locatorFactory.error.connect([](const std::string& message) {
-          std::cout << "Locator error: " << message << std::endl;
+          FR_LOG_ERROR(Rest, "Locator error: {}", message);
         });
       auto graphFailSub =
         _graphFactory.error.connect([](const std::string& message) {
-          std::cout << "Graph error: " << message << std::endl;
+          FR_LOG_ERROR(Rest, "Graph error: {}", message);
         });
       _subscriptions.push_back(std::move(locatorAvailableSub));
       _subscriptions.push_back(std::move(displayGraphSub));
@@ -145,13 +149,13 @@ namespace fr::Imgui {
       _show = false;
       _displayWindow = false;
 
-      _urlLabel = getUniqueLabel("##URL");
-      _serverInputLabel = getUniqueLabel("##serverInput");
-      _refreshButtonLabel = getUniqueLabel("Refresh");
-      _tableLabel = getUniqueLabel("##LoadTable");
-      _uuidColumn = getUniqueLabel("UUID");
-      _titleColumn = getUniqueLabel("Title");
-      _loadColumn = getUniqueLabel("Load");
+      _urlLabel = "##URL";
+      _serverInputLabel = "##serverInput";
+      _refreshButtonLabel = "Refresh";
+      _tableLabel = "##LoadTable";
+      _uuidColumn = "UUID";
+      _titleColumn = "Title";
+      _loadColumn = "Load";
       
       // If your window factory doesn't open windows, I probably forgot to
       // call addEditorWindow on this object in main.cpp
@@ -200,37 +204,40 @@ namespace fr::Imgui {
         Parent::begin();
         ImGui::Text("URL: ");
         ImGui::SameLine();
-        ImGui::InputText(_urlLabel.c_str(),
+        ImGui::InputText(_urlLabel,
                          _url,
                          urlLen - 1);
 
         // We'll be accessing _graphs for few lines, so lock it.
         std::lock_guard<std::mutex> lock(_graphsMutex);
-        if (ImGui::Button(_refreshButtonLabel.c_str())) {
+        if (ImGui::Button(_refreshButtonLabel)) {
           // Clear out the graphs vector so we don't end up with thousands of
           // load buttons in our table.
-          std::cout << "Requesting loaderfactory fetch " << _url << std::endl;
+          FR_LOG_INFO(Rest, "Requesting loaderfactory fetch {}", _url);
           _graphs.clear();
           _locatorFactory.fetch(_url);
         }
         
-        if (ImGui::BeginTable(_tableLabel.c_str(), 3)) {
-          ImGui::TableSetupColumn(_loadColumn.c_str());
-          ImGui::TableSetupColumn(_uuidColumn.c_str());
-          ImGui::TableSetupColumn(_titleColumn.c_str());
+        if (ImGui::BeginTable(_tableLabel, 3)) {
+          ImGui::TableSetupColumn(_loadColumn);
+          ImGui::TableSetupColumn(_uuidColumn);
+          ImGui::TableSetupColumn(_titleColumn);
 
-          for (auto _graph : _graphs) {
+          for (size_t row = 0; row < _graphs.size(); ++row) {
+            const auto &graph = _graphs[row];
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
-            std::string loadButton("Load##");
-            loadButton.append(_graph->getGraphUuid());
-            if (ImGui::Button(loadButton.c_str())) {
-              _graphFactory.fetch(_graph->getGraphAddress());
+            // Scope the button ID by row rather than building a
+            // "Load##uuid" string for every row every frame
+            ImGui::PushID(static_cast<int>(row));
+            if (ImGui::Button("Load")) {
+              _graphFactory.fetch(graph->getGraphAddress());
             }
+            ImGui::PopID();
             ImGui::TableNextColumn();
-            ImGui::Text(_graph->getGraphUuid().c_str());
+            ImGui::TextUnformatted(graph->getGraphUuid().c_str());
             ImGui::TableNextColumn();
-            ImGui::Text(_graph->getGraphTitle().c_str());
+            ImGui::TextUnformatted(graph->getGraphTitle().c_str());
           }
         }
         ImGui::EndTable();
@@ -16,53 +16,54 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 
 namespace fr::Imgui {
 
-  class RoleWindow : public NodeWindow {
+  class RoleWindow : public TypedNodeWindow<fr::RequirementsManager::Role> {
   protected:
     static const size_t whoLen = 201;
     char _who[whoLen];
-    std::string _whoLabel;
+    const char *_whoLabel;
 
   public:
     using Type = RoleWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Role>;
     using NodeType = fr::RequirementsManager::Role;
 
     RoleWindow(const std::string &title = "Role") : Parent(title) {
       memset(_who, '\0', whoLen);
-      _whoLabel = getUniqueLabel("##Who");
+      _whoLabel = "##Who";
     }
 
     virtual ~RoleWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_who, node->getWho().c_str(), whoLen - 1);
       }
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_who);
+    }
+
     void begin() override {
       Parent::begin();
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Who:");
         ImGui::SameLine();
-        if (ImGui::InputText(_whoLabel.c_str(),
+        if (ImGui::InputText(_whoLabel,
                              _who,
                              whoLen - 1,
                              inputTextFlags)) {
@@ -17,41 +17,39 @@
 #pragma once
 
 #include <fr/RequirementsManager/Story.h>
+#include <format>
 #include <fr/ImguiWidgets.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class StoryWindow : public CommitableNodeWindow {
+  class StoryWindow : public TypedNodeWindow<fr::RequirementsManager::Story, CommitableNodeWindow> {
     static const size_t titleLen = 201;
     char _titleText[titleLen];
-    std::string _titleLabel;
-    std::string _goalLabel;
+    const char *_titleLabel;
+    const char *_goalLabel;
     std::string _goal;
-    std::string _benefitLabel;
+    const char *_benefitLabel;
     std::string _benefit;
 
   public:
     using Type = StoryWindow;
     using PtrType = std::shared_ptr<StoryWindow>;
-    using Parent = CommitableNodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Story, CommitableNodeWindow>;
     using NodeType = fr::RequirementsManager::Story;
 
     StoryWindow(const std::string &title = "Story") : Parent(title) {
       memset(_titleText, '\0', titleLen);
-      _titleLabel = getUniqueLabel("##Title");
-      _goalLabel = getUniqueLabel("##Goal");
-      _benefitLabel = getUniqueLabel("##Benefit");
+      _titleLabel = "##Title";
+      _goalLabel = "##Goal";
+      _benefitLabel = "##Benefit";
     }
 
     virtual ~StoryWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::Story>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Story>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         strncpy(_titleText, node->getTitle().c_str(), titleLen - 1);
         _goal = node->getGoal();
@@ -60,32 +58,36 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{}", _titleText, _goal));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::Story>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable && !node->isCommitted()) {
+        if (editable() && !node->isCommitted()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Title: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_titleLabel.c_str(),
+        if (ImGui::InputText(_titleLabel,
                              _titleText,
                              titleLen - 1,
                              inputTextFlags)) {
           node->setTitle(_titleText);
         }
         ImGui::Text("Goal:");
-        if (ImGui::InputTextMultiline(_goalLabel.c_str(),
+        if (ImGui::InputTextMultiline(_goalLabel,
                                       &_goal,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
           node->setGoal(_goal);
         }
         ImGui::Text("Benefit:");
-        if (ImGui::InputTextMultiline(_benefitLabel.c_str(),
+        if (ImGui::InputTextMultiline(_benefitLabel,
                                       &_benefit,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
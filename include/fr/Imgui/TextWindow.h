@@ -16,35 +16,32 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class TextWindow : public NodeWindow {
+  class TextWindow : public TypedNodeWindow<fr::RequirementsManager::Text> {
   protected:
     std::string _text;
-    std::string _textLabel;
+    const char *_textLabel;
     
   public:
     using Type = TextWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::Text>;
     using NodeType = fr::RequirementsManager::Text;
 
     TextWindow(const std::string &title = "Text") : Parent(title) {
-      _textLabel = getUniqueLabel("##Text");
+      _textLabel = "##Text";
     }
 
     virtual ~TextWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         _text = node->getText();
       }
@@ -52,17 +49,21 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_text);
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Text:");
-        if (ImGui::InputTextMultiline(_textLabel.c_str(),
+        if (ImGui::InputTextMultiline(_textLabel,
                                       &_text,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -25,49 +25,70 @@
 #include <ctime>
 #include <format>
 #include <ImGuiDatePicker.hpp>
-#include <fr/Imgui/NodeWindow.h>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 #include <memory>
 
 namespace fr::Imgui {
 
-  class TimeEstimateWindow : public NodeWindow {
+  class TimeEstimateWindow : public TypedNodeWindow<fr::RequirementsManager::TimeEstimate> {
   protected:
     std::string _text;
-    std::string _textLabel;
-    std::string _estimateLabel;
+    const char *_textLabel;
+    const char *_estimateLabel;
     unsigned long _estimate;
-    std::string _startedLabel;
+    const char *_startedLabel;
     bool _started;
-    std::string _startedTimestampLabel;
+    const char *_startedTimestampLabel;
     time_t _startedTimestamp;
     // Making these class members so I don't have to
     // query the system clock ever single frame
     time_t _now;
     tm _tmNow;
+    // Text for the started/remaining lines and the estimate date.
+    // These only change when the node does, so they get built then
+    // instead of being formatted every frame.
+    std::string _startedText;
+    std::string _remainingText;
+    static const size_t dateTextLen = 32;
+    char _estimateDateText[dateTextLen];
 
   public:
     using Type = TimeEstimateWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::TimeEstimate>;
     using NodeType = fr::RequirementsManager::TimeEstimate;
 
+  protected:
+    void updateEstimateText(NodeType *node) {
+      time_t estimateEnd = (_started ? node->getStartTimestamp() : _now) + node->getEstimate();
+      tm tmEstimate = *std::gmtime(&estimateEnd);
+      std::strftime(_estimateDateText, dateTextLen, "%F", &tmEstimate);
+      if (_started) {
+        auto started = std::chrono::system_clock::from_time_t(node->getStartTimestamp());
+        auto estEnd = started + std::chrono::seconds(node->getEstimate());
+        auto remaining = estEnd - std::chrono::system_clock::from_time_t(_now);
+        auto daysRemaining = std::chrono::floor<std::chrono::days>(remaining);
+        _startedText = std::format("Started: {:%FT%TZ}", started);
+        _remainingText = std::format("Est. Days Remaining: {}", daysRemaining);
+      }
+    }
+
+  public:
     TimeEstimateWindow(const std::string &title = "TimeEstimate") : Parent(title) {
-      _textLabel = getUniqueLabel("##Text");
-      _estimateLabel = getUniqueLabel("##Estimate");
-      _startedLabel = getUniqueLabel("##Started");
-      _startedTimestampLabel = getUniqueLabel("##StartedTimestamp");
+      _textLabel = "##Text";
+      _estimateLabel = "##Estimate";
+      _startedLabel = "##Started";
+      _startedTimestampLabel = "##StartedTimestamp";
+      memset(_estimateDateText, '\0', dateTextLen);
     }
 
     virtual ~TimeEstimateWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         _text = node->getText();
         _estimate = node->getEstimate();
@@ -77,23 +98,30 @@ namespace fr::Imgui {
       auto now = std::chrono::system_clock::now();
       _now = std::chrono::system_clock::to_time_t(now);
       _tmNow = *std::gmtime(&_now);
+      if (node) {
+        updateEstimateText(node);
+      }
 
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\nEstimate: {}", _text, _estimateDateText));
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
 
 
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Text:");
-        if (ImGui::InputTextMultiline(_textLabel.c_str(),
+        if (ImGui::InputTextMultiline(_textLabel,
                                       &_text,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -101,35 +129,39 @@ namespace fr::Imgui {
         }
         ImGui::Text("Stated: ");
         ImGui::SameLine();
-        if (ImGui::Checkbox(_startedLabel.c_str(), &_started)) {
+        ImGui::BeginDisabled(!editable());
+        bool startedChanged = ImGui::Checkbox(_startedLabel, &_started);
+        ImGui::EndDisabled();
+        if (startedChanged) {
           node->setStarted(_started);
           if (_started) {
             auto now = std::chrono::system_clock::now();
             _startedTimestamp = std::chrono::system_clock::to_time_t(now);
             node->setStartTimestamp(_startedTimestamp);            
           }
+          updateEstimateText(node);
         }
-        if (ImGui::DatePicker(_estimateLabel.c_str(), _tmNow)) {
-          auto estimate = std::mktime(&_tmNow);
-          if (_started) {
-            estimate -= node->getStartTimestamp();
-          } else {
-            estimate -= _now;
+        // Only bring up the date picker when the window is editable.
+        // Otherwise just show the date.
+        if (editable()) {
+          if (ImGui::DatePicker(_estimateLabel, _tmNow)) {
+            auto estimate = std::mktime(&_tmNow);
+            if (_started) {
+              estimate -= node->getStartTimestamp();
+            } else {
+              estimate -= _now;
+            }
+            node->setEstimate(estimate);
+            updateEstimateText(node);
           }
-          node->setEstimate(estimate);
+        } else {
+          ImGui::Text("Estimate: ");
+          ImGui::SameLine();
+          ImGui::TextUnformatted(_estimateDateText);
         }
         if (_started) {
-          // TODO: I'm not sure I want to do this many calculations over
-          // a large number of windows. Consider moving this to init
-          // or doing another function to compute them once into class members.
-          auto started = std::chrono::system_clock::from_time_t(node->getStartTimestamp());
-          auto estEnd = started + std::chrono::seconds(node->getEstimate());
-          auto remaining = estEnd - std::chrono::system_clock::from_time_t(_now);
-          auto daysRemaining = std::chrono::floor<std::chrono::days>(remaining);
-          auto startedLabel = std::format("Started: {:%FT%TZ}", started);
-          ImGui::Text(startedLabel.c_str());
-          auto remainingLabel = std::format("Est. Days Remaining: {}", daysRemaining);
-          ImGui::Text(remainingLabel.c_str());
+          ImGui::TextUnformatted(_startedText.c_str());
+          ImGui::TextUnformatted(_remainingText.c_str());
         }        
       } else {
         ImGui::Text("If you're seeing this, this window somehow doesn't have a node");
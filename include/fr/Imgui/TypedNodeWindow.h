@@ -0,0 +1,69 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fr/Imgui/NodeWindow.h>
+#include <memory>
+#include <utility>
+
+namespace fr::Imgui {
+
+  /**
+   * A NodeWindow for nodes of NodeT. It casts _node to NodeT when the
+   * node is set and keeps the result in _typedNode, so begin doesn't
+   * have to dynamic_cast it every frame.
+   *
+   * ParentT is the window to build on, NodeWindow or something
+   * derived from it (CommitableNodeWindow, say). Every layer keeps
+   * its own _typedNode, and all of them get set through addNode.
+   */
+
+  template <typename NodeT, typename ParentT = NodeWindow>
+  class TypedNodeWindow : public ParentT {
+  protected:
+    // _node as a NodeT. Null if there's no node or it isn't a NodeT.
+    // _node owns it.
+    NodeT *_typedNode;
+
+    // Gives the window a new NodeT if it doesn't have a node yet.
+    // Returns true if it made one. Call from init.
+    bool ensureNode() {
+      if (this->_node) {
+        return false;
+      }
+      auto node = std::make_shared<NodeT>();
+      node->init();
+      this->addNode(node);
+      return true;
+    }
+
+  public:
+    using NodeType = NodeT;
+
+    template <typename... Args>
+    explicit TypedNodeWindow(Args &&...args) : ParentT(std::forward<Args>(args)...), _typedNode(nullptr) {
+    }
+
+    virtual ~TypedNodeWindow() {}
+
+    void addNode(fr::RequirementsManager::Node::PtrType node) override {
+      _typedNode = dynamic_cast<NodeT *>(node.get());
+      ParentT::addNode(std::move(node));
+    }
+  };
+
+}
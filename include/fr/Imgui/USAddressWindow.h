@@ -16,13 +16,14 @@
 
 #pragma once
 
-#include <fr/Imgui/NodeWindow.h>
+#include <format>
+#include <fr/Imgui/TypedNodeWindow.h>
 #include <fr/RequirementsManager/UtilityNodes.h>
 #include <imgui_stdlib.h>
 
 namespace fr::Imgui {
 
-  class USAddressWindow : public NodeWindow {
+  class USAddressWindow : public TypedNodeWindow<fr::RequirementsManager::USAddress> {
     static const size_t cityLen = 101;
     static const size_t stateLen = 41;
     static const size_t zipCodeLen = 21;
@@ -30,35 +31,32 @@ namespace fr::Imgui {
     char _city[cityLen];
     char _state[stateLen];
     char _zipCode[zipCodeLen];
-    std::string _addressLinesLabel;
-    std::string _cityLabel;
-    std::string _stateLabel;
-    std::string _zipCodeLabel;
+    const char *_addressLinesLabel;
+    const char *_cityLabel;
+    const char *_stateLabel;
+    const char *_zipCodeLabel;
 
   public:
     using Type = USAddressWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = NodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::USAddress>;
     using NodeType = fr::RequirementsManager::USAddress;
 
     USAddressWindow(const std::string &title = "US Address") : Parent(title) {
       memset(_city, '\0', cityLen);
       memset(_state, '\0', stateLen);
       memset(_zipCode, '\0', zipCodeLen);
-      _addressLinesLabel = getUniqueLabel("##AddressLines");
-      _cityLabel = getUniqueLabel("##City");
-      _stateLabel = getUniqueLabel("##State");
-      _zipCodeLabel = getUniqueLabel("##ZipCode");
+      _addressLinesLabel = "##AddressLines";
+      _cityLabel = "##City";
+      _stateLabel = "##State";
+      _zipCodeLabel = "##ZipCode";
     }
 
     virtual ~USAddressWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<NodeType>();
-        _node->init();
-      }
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      ensureNode();
+      auto node = _typedNode;
       if (node) {
         _addressLines = node->getAddressLines();
         strncpy(_city, node->getCity().c_str(), cityLen - 1);
@@ -68,18 +66,22 @@ namespace fr::Imgui {
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(std::format("{}\n{}, {} {}", _addressLines, _city, _state, _zipCode));
+    }
+
     void begin() override {
       Parent::begin();
       
-      auto node = dynamic_pointer_cast<NodeType>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
         // Do not allow any editing if node is committed
-        if (_editable) {
+        if (editable()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
         ImGui::Text("Address:");
-        if (ImGui::InputTextMultiline(_addressLinesLabel.c_str(),
+        if (ImGui::InputTextMultiline(_addressLinesLabel,
                                       &_addressLines,
                                       ImVec2(0,0),
                                       inputTextFlags)) {
@@ -87,7 +89,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("City: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_cityLabel.c_str(),
+        if (ImGui::InputText(_cityLabel,
                              _city,
                              cityLen - 1,
                              inputTextFlags)) {
@@ -95,7 +97,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("State: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_stateLabel.c_str(),
+        if (ImGui::InputText(_stateLabel,
                              _state,
                              stateLen - 1,
                              inputTextFlags)) {
@@ -103,7 +105,7 @@ namespace fr::Imgui {
         }
         ImGui::Text("Zip Code: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_zipCodeLabel.c_str(),
+        if (ImGui::InputText(_zipCodeLabel,
                              _zipCode,
                              zipCodeLen - 1,
                              inputTextFlags)) {
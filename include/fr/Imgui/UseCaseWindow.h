@@ -21,13 +21,13 @@
 
 namespace fr::Imgui {
 
-  class UseCaseWindow : public CommitableNodeWindow {
+  class UseCaseWindow : public TypedNodeWindow<fr::RequirementsManager::UseCase, CommitableNodeWindow> {
     static const size_t nameLen = 201;
     char _nameText[nameLen];
-    std::string _nameLabel;
+    const char *_nameLabel;
 
     void setNameText() {
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::UseCase>(_node);
+      auto node = _typedNode;
       if (node) {
         strncpy(_nameText, node->getName().c_str(), nameLen - 1);
       }
@@ -36,38 +36,39 @@ namespace fr::Imgui {
   public:
     using Type = UseCaseWindow;
     using PtrType = std::shared_ptr<Type>;
-    using Parent = CommitableNodeWindow;
+    using Parent = TypedNodeWindow<fr::RequirementsManager::UseCase, CommitableNodeWindow>;
     using NodeType = fr::RequirementsManager::UseCase;
 
     UseCaseWindow(const std::string &title = "Use Case") : Parent(title) {
       memset(_nameText, '\0', nameLen);
-      _nameLabel = getUniqueLabel("##Name");
+      _nameLabel = "##Name";
     }
 
     virtual ~UseCaseWindow() {}
 
     void init() override {
-      if (!_node) {
-        _node = std::make_shared<fr::RequirementsManager::UseCase>();
-        _node->init();
-      }
+      ensureNode();
       setNameText();
       Parent::init();
     }
 
+    std::string summary() override {
+      return summarize(_nameText);
+    }
+
     void begin() override {
       Parent::begin();
 
-      auto node = dynamic_pointer_cast<fr::RequirementsManager::UseCase>(_node);
+      auto node = _typedNode;
       if (node) {
         auto inputTextFlags = ImGuiInputTextFlags_ReadOnly;
-        if (_editable && !node->isCommitted()) {
+        if (editable() && !node->isCommitted()) {
           inputTextFlags = (ImGuiInputTextFlags_) 0;
         }
       
         ImGui::Text("Name: ");
         ImGui::SameLine();
-        if (ImGui::InputText(_nameLabel.c_str(),
+        if (ImGui::InputText(_nameLabel,
                              _nameText,
                              nameLen - 1,
                              inputTextFlags)) {
@@ -33,29 +33,33 @@ namespace fr::Imgui {
     using PtrType = std::shared_ptr<Widget>;
 
   protected:
-    // Parent window if one exists
-    std::shared_ptr<Window> _parent;
+    // Parent window if one exists. The parent holds its widgets, so
+    // this is weak. _parentWindow is the same window for the calls
+    // widgets make every frame, good as long as _parent hasn't
+    // expired (see parentWindow).
+    std::weak_ptr<Window> _parent;
+    Window *_parentWindow;
     // Label for this widget. This will potentially
-    // be handy if I want to surface it in ImGui.
+    // be handy if I want to surface it in ImGui. Widgets render
+    // inside their parent window's ID scope, so this only has to be
+    // unique among the parent's widgets.
     const std::string _label;
-    
-    std::string getUniqueLabel(const std::string startingLabel) {
-      boost::uuids::uuid id;
-      boost::uuids::time_generator_v7 generator;
-      id = generator();
-      std::string ret = std::format("{}##{}", startingLabel, boost::uuids::to_string(id));
-      return ret;
-    }
 
   public:
 
-    Widget(const std::string label = "") : _label(getUniqueLabel(label)) {
+    Widget(const std::string label = "") : _parentWindow(nullptr), _label(label) {
     }
     
     virtual ~Widget() {}
 
     void setParent(std::shared_ptr<Window> p) override {
       _parent = p;
+      _parentWindow = p.get();
+    }
+
+    // Parent window, or null if there isn't one or it's gone
+    Window *parentWindow() const {
+      return _parent.expired() ? nullptr : _parentWindow;
     }
 
     std::string getLabel() override {
@@ -17,16 +17,25 @@
 #pragma once
 
 #include <fteng/signals.hpp>
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
 #include <format>
+#include <fr/Imgui/AnchorIndex.h>
+#include <fr/Imgui/Canvas.h>
+#include <fr/Imgui/EdgeStore.h>
+#include <fr/Imgui/IniSettings.h>
+#include <fr/Imgui/NodeHandles.h>
+#include <fr/Imgui/Profiler.h>
 #include <fr/Imgui/WidgetApi.h>
 #include <imgui.h>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace fr::Imgui {
 
@@ -39,7 +48,9 @@ namespace fr::Imgui {
     using PtrType = std::shared_ptr<Window>;
     
   protected:
-    const std::string _label;
+    // Window name. NodeWindow swaps the counter suffix for its
+    // node's UUID once it has a node, so this can't be const.
+    std::string _label;
     ImVec2 _lastMin;
     // Top left corner in screen coordinates
     ImVec2 _min;
@@ -47,15 +58,51 @@ namespace fr::Imgui {
     ImVec2 _startingSize;
     // Current size (width x height)
     ImVec2 _currentSize;
+    // Full window size including the title bar, as of the last
+    // frame the window rendered
+    ImVec2 _windowSize;
     // Window color
     ImVec4 _backgroundColor;
-    // A map of child windows to display
+    // Child windows and widgets live in two places. The render lists
+    // are what renderChildren walks, in insertion order, and only the
+    // render thread touches them. The maps are the key lookup and are
+    // what add/get/remove work with, under _childrenMutex. Adds and
+    // removes get staged and the render lists catch up at the start
+    // of the next renderChildren, so the render walk itself doesn't
+    // hold the lock. That also makes it safe for a child to add or
+    // remove windows while it's rendering.
     std::mutex _childrenMutex;
+    // Nanoseconds add/get/remove have spent waiting for and holding
+    // _childrenMutex. WindowFactory uses this to see how much of a
+    // load went to fighting the render loop for the lock.
+    std::atomic<uint64_t> _childrenLockNanos;
     std::unordered_map<std::string, Window::PtrType> _children;
-    // A map of widgets to display
     std::unordered_map<std::string, std::shared_ptr<WidgetApi>> _widgets;
-    // parent window if one exists
-    Window::PtrType _parent;
+    std::vector<Window::PtrType> _childRenderList;
+    std::vector<std::shared_ptr<WidgetApi>> _widgetRenderList;
+    // Staged changes to the render lists
+    std::vector<Window::PtrType> _pendingChildAdds;
+    std::vector<Window::PtrType> _pendingChildRemoves;
+    std::vector<std::shared_ptr<WidgetApi>> _pendingWidgetAdds;
+    // Set when something is staged so renderChildren only takes the
+    // lock on frames where there's something to apply
+    std::atomic<bool> _childrenChanged;
+    // parent window if one exists. Weak, since the parent holds the
+    // child and the pair would otherwise keep each other alive.
+    std::weak_ptr<Window> _parent;
+    // Pan/zoom transform children are drawn through. Windows that
+    // own one (GridWindow) point this at it, everything else gets
+    // it from the window it's added to. Can be null.
+    Canvas *_canvas;
+    // Where node anchors register their links so they get drawn once.
+    // Handed down the same way as _canvas. Can be null.
+    EdgeStore *_edgeStore;
+    // Spatial index node anchors keep their positions in. Handed
+    // down like _canvas. Can be null.
+    AnchorIndex *_anchorIndex;
+    // UUID to NodeHandle table for the editor's nodes. Handed down
+    // like _canvas. Can be null.
+    NodeHandles *_nodeHandles;
     // Window's begin has been called the first time
     // This is use to set up initialization stuff for imgui
     bool _started;
@@ -64,15 +111,54 @@ namespace fr::Imgui {
       _parent = p;
     }
 
+    // Brings the render lists up to date with the staged adds and
+    // removes. Render thread only.
+    void applyPendingChildren() {
+      if (!_childrenChanged.exchange(false, std::memory_order_acquire)) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(_childrenMutex);
+      _childRenderList.insert(_childRenderList.end(), _pendingChildAdds.begin(), _pendingChildAdds.end());
+      _widgetRenderList.insert(_widgetRenderList.end(), _pendingWidgetAdds.begin(), _pendingWidgetAdds.end());
+      if (!_pendingChildRemoves.empty()) {
+        // One pass over the render list no matter how many went away.
+        // Closing a graph removes thousands at once, so look them up
+        // in a set rather than scanning the removes for each child.
+        std::unordered_set<const Window *> removes;
+        removes.reserve(_pendingChildRemoves.size());
+        for (const auto &child : _pendingChildRemoves) {
+          removes.insert(child.get());
+        }
+        std::erase_if(_childRenderList, [&](const Window::PtrType &child) {
+          return removes.contains(child.get());
+        });
+      }
+      _pendingChildAdds.clear();
+      _pendingChildRemoves.clear();
+      _pendingWidgetAdds.clear();
+    }
+
+    // Adds the time since start to _childrenLockNanos
+    void addChildrenLockTime(std::chrono::steady_clock::time_point start) {
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      _childrenLockNanos.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                   std::memory_order_relaxed);
+    }
+
     // Imgui seems to need to be set with unqiue string lebels for
     // everything, so this will just tag a label with a hidden
-    // uuid and return it for such use
-    std::string getUniqueLabel(const std::string startingLabel) {
-      boost::uuids::uuid id;
-      boost::uuids::time_generator_v7 generator;
-      id = generator();
-      std::string ret = std::format("{}##{}", startingLabel, boost::uuids::to_string(id));
-      return ret;
+    // number and return it for such use. Only window names and
+    // things outside any one window (like file dialog keys) need
+    // this. Widgets are already scoped to the window they're in,
+    // since ImGui seeds their IDs with the window's, so they can
+    // use plain string literals.
+    std::string getUniqueLabel(const std::string &startingLabel) {
+      return std::format("{}##{:x}", startingLabel, nextLabelId());
+    }
+
+    static uint32_t nextLabelId() {
+      static std::atomic<uint32_t> next{1};
+      return next.fetch_add(1, std::memory_order_relaxed);
     }
     
   public:
@@ -89,7 +175,14 @@ namespace fr::Imgui {
                                        _lastMin(0,0),
                                        _min(0,0),
                                        _startingSize(0,0),
+                                       _windowSize(0,0),
                                        _backgroundColor(0.0,0.0,0.0,1.0),
+                                       _childrenLockNanos(0),
+                                       _childrenChanged(false),
+                                       _canvas(nullptr),
+                                       _edgeStore(nullptr),
+                                       _anchorIndex(nullptr),
+                                       _nodeHandles(nullptr),
                                        _started(false) {
     }
 
@@ -99,18 +192,47 @@ namespace fr::Imgui {
     // Add a child window. Key is just some string you can
     // use to retrieve the window later.
     virtual void add(const std::string& key, Window::PtrType child) {
-      std::lock_guard<std::mutex> lock(_childrenMutex);
-      if (!_children.contains(key)) {
-        _children[key] = child;
-        child->setParent(shared_from_this());
-      } 
+      auto start = std::chrono::steady_clock::now();
+      {
+        std::lock_guard<std::mutex> lock(_childrenMutex);
+        if (!_children.contains(key)) {
+          _children[key] = child;
+          // Removed and added back before the render list caught up,
+          // so it's still there. Cancel the remove rather than adding
+          // it a second time.
+          auto pending = std::find(_pendingChildRemoves.begin(), _pendingChildRemoves.end(), child);
+          if (pending != _pendingChildRemoves.end()) {
+            _pendingChildRemoves.erase(pending);
+          } else {
+            _pendingChildAdds.push_back(child);
+            _childrenChanged.store(true, std::memory_order_release);
+          }
+          child->setParent(shared_from_this());
+          if (_canvas) {
+            child->setCanvas(_canvas);
+          }
+          if (_edgeStore) {
+            child->setEdgeStore(_edgeStore);
+          }
+          if (_anchorIndex) {
+            child->setAnchorIndex(_anchorIndex);
+          }
+          if (_nodeHandles) {
+            child->setNodeHandles(_nodeHandles);
+          }
+        }
+      }
+      addChildrenLockTime(start);
     }
 
     // Add a widget. Key can be used to retrieve the widget
     // later.
     virtual void addWidget(const std::string& key, std::shared_ptr<WidgetApi> w) {
+      std::lock_guard<std::mutex> lock(_childrenMutex);
       if (!_widgets.contains(key)) {
         _widgets[key] = w;
+        _pendingWidgetAdds.push_back(w);
+        _childrenChanged.store(true, std::memory_order_release);
         w->setParent(shared_from_this());
       } 
     }
@@ -118,24 +240,82 @@ namespace fr::Imgui {
     // Retrieve a child window from the children list. Can return
     // a null shared ptr.
     Window::PtrType get(const std::string& key) {
-      std::lock_guard<std::mutex> lock(_childrenMutex);
+      auto start = std::chrono::steady_clock::now();
       Window::PtrType ret;
-      if (_children.contains(key)) {
-        ret = _children[key];
+      {
+        std::lock_guard<std::mutex> lock(_childrenMutex);
+        auto found = _children.find(key);
+        if (found != _children.end()) {
+          ret = found->second;
+        }
       }
+      addChildrenLockTime(start);
       return ret;
     }
 
     // Remove a child window from the children list
     void remove(const std::string& key) {
-      std::lock_guard<std::mutex> lock(_childrenMutex);
-      if (_children.contains(key)) {
-        _children.erase(key);
+      auto start = std::chrono::steady_clock::now();
+      {
+        std::lock_guard<std::mutex> lock(_childrenMutex);
+        auto found = _children.find(key);
+        if (found != _children.end()) {
+          auto child = found->second;
+          _children.erase(found);
+          // If it never made it to the render list, just unstage it
+          auto pending = std::find(_pendingChildAdds.begin(), _pendingChildAdds.end(), child);
+          if (pending != _pendingChildAdds.end()) {
+            _pendingChildAdds.erase(pending);
+          } else {
+            _pendingChildRemoves.push_back(child);
+            _childrenChanged.store(true, std::memory_order_release);
+          }
+        }
       }
+      addChildrenLockTime(start);
+    }
+
+    // Total time add, get and remove have spent on _childrenMutex,
+    // in nanoseconds
+    uint64_t childrenLockNanos() const {
+      return _childrenLockNanos.load(std::memory_order_relaxed);
+    }
+
+    virtual void setCanvas(Canvas *canvas) {
+      _canvas = canvas;
+    }
+
+    Canvas *getCanvas() {
+      return _canvas;
+    }
+
+    virtual void setEdgeStore(EdgeStore *edgeStore) {
+      _edgeStore = edgeStore;
+    }
+
+    EdgeStore *getEdgeStore() {
+      return _edgeStore;
+    }
+
+    virtual void setAnchorIndex(AnchorIndex *anchorIndex) {
+      _anchorIndex = anchorIndex;
+    }
+
+    AnchorIndex *getAnchorIndex() {
+      return _anchorIndex;
+    }
+
+    virtual void setNodeHandles(NodeHandles *nodeHandles) {
+      _nodeHandles = nodeHandles;
+    }
+
+    NodeHandles *getNodeHandles() {
+      return _nodeHandles;
     }
 
     // Returns true if the children list contains the key
     bool contains(std::string& key) {
+      std::lock_guard<std::mutex> lock(_childrenMutex);
       return _children.contains(key);
     }
 
@@ -171,25 +351,33 @@ namespace fr::Imgui {
     }
 
     virtual void renderChildren() {
-      {
-        std::lock_guard<std::mutex> lock(_childrenMutex);
-        for (auto [key, child] : _children) {
-          child->begin();
-          child->end();
-        }
+      FR_PROFILE_TOTAL("Window::renderChildren");
+      applyPendingChildren();
+      // No lock here, add and remove only touch the staging lists
+      for (const auto &child : _childRenderList) {
+        child->render();
       }
-      for (auto [key, widget] : _widgets) {
+      for (const auto &widget : _widgetRenderList) {
         widget->begin();
         widget->end();
       }
     }
 
+    // Called by the parent window's renderChildren each frame.
+    // Override to skip or cut down rendering, like NodeWindow does
+    // when it's off screen.
+    virtual void render() {
+      begin();
+      end();
+    }
+
     // Override to run something the very first time begin runs.
     // You should generally always call the parent beginning
     // method at the beginning or end of your overrideen beginning
     // method if you do this.
     virtual void beginning() {
       _started = true;
+      IniSettings::instance().touch(_label);
       ImGui::SetNextWindowSize(_startingSize);
     }
 
@@ -199,14 +387,17 @@ namespace fr::Imgui {
     }
     
     virtual void begin() {
+      FR_PROFILE_TOTAL("Window::begin");
       if (!_started) {
         beginning();
       }
       ImGui::PushStyleColor(ImGuiCol_WindowBg, _backgroundColor);
       Begin();
       _min = ImGui::GetWindowPos();
+      _windowSize = ImGui::GetWindowSize();
       if ((_min.x != _lastMin.x) || (_min.y != _lastMin.y)) {
         moved(shared_from_this(), _min);
+        _lastMin = _min;
       }
       _currentSize = ImGui::GetContentRegionAvail();
       if ((_currentSize.x != _startingSize.x) || (_currentSize.y != _startingSize.y)) {
@@ -15,16 +15,37 @@
  */
 
 #pragma once
+#ifndef NO_LOAD_SAVE_JSON
+#include <fr/Imgui/GraphFile.h>
+#endif
 #include <fr/RequirementsManager.h>
 #include <fr/RequirementsManager/RestFactoryApi.h>
 #include <fr/RequirementsManager/TaskNode.h>
 #include <fr/RequirementsManager/ThreadPool.h>
+#include <fr/Imgui/GraphArena.h>
+#include <fr/Imgui/GraphLoad.h>
+#include <fr/Imgui/Log.h>
 #include <fr/Imgui/NodeEditorWindow.h>
+#include <fr/Imgui/Profiler.h>
 #include <fr/Imgui/Registration.h>
+#include <fr/Imgui/RenderWake.h>
+#include <fr/Imgui/WindowTable.h>
 #include <fr/ImguiWidgets.h>
 #include <fr/types/Concepts.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 
 #ifndef NO_SQL
 #include <fr/RequirementsManager/PqNodeFactory.h>
@@ -39,6 +60,19 @@ namespace fr::Imgui {
   template <typename WindowList>
   requires fr::types::IsUnique<WindowList>
   class WindowFactory;
+
+  /**
+   * has_change_setters is looking for a CommitableNode that can have
+   * its change parent and child cleared. RequirementsManager is its
+   * own project, so closeGraph checks for these rather than assuming
+   * them.
+   */
+
+  template <typename NodeT>
+  concept has_change_setters = requires(NodeT &node) {
+    node.setChangeParent(nullptr);
+    node.setChangeChild(nullptr);
+  };
   
   /**
    * A cleanup task I can just enqueue to the threadpool
@@ -67,34 +101,319 @@ namespace fr::Imgui {
     
   };
   
+  /**
+   * Where the time went for one WindowFactory load. The stages nest:
+   * traverse covers the whole node->traverse call, which includes
+   * createWindow and editorAdd. childrenLock is the part of the load
+   * spent waiting for or holding the editor's _childrenMutex.
+   */
+
+  struct WindowFactoryStats {
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    Duration traverse{0};
+    Duration createWindow{0};
+    Duration editorAdd{0};
+    Duration connect{0};
+    Duration childrenLock{0};
+    Duration total{0};
+
+    size_t nodesVisited = 0;
+    size_t windowsCreated = 0;
+    // Queued nodes that already had a window, from another graph or
+    // an earlier load of the same one
+    size_t windowsSkipped = 0;
+    // dynamic_casts tried for nodes whose type has no WindowTable entry
+    size_t castsAttempted = 0;
+    size_t connectionsEstablished = 0;
+    // Links that were already there, usually because both ends came
+    // in with the same batch and the first end made the link
+    size_t connectionsSkipped = 0;
+
+    // Materializing a graph happens a few windows per frame, so the
+    // stats for one load get added up over a lot of calls
+    WindowFactoryStats &operator+=(const WindowFactoryStats &other) {
+      traverse += other.traverse;
+      createWindow += other.createWindow;
+      editorAdd += other.editorAdd;
+      connect += other.connect;
+      nodesVisited += other.nodesVisited;
+      windowsCreated += other.windowsCreated;
+      windowsSkipped += other.windowsSkipped;
+      castsAttempted += other.castsAttempted;
+      connectionsEstablished += other.connectionsEstablished;
+      connectionsSkipped += other.connectionsSkipped;
+      return *this;
+    }
+
+    std::string toString() const {
+      return std::format("{} nodes visited, {} windows created, {} already open, {} casts attempted, "
+                         "{} connections established, {} skipped; "
+                         "total {:.3f} ms: traverse {:.3f} ms (createWindow {:.3f} ms, editor add {:.3f} ms), "
+                         "connect {:.3f} ms, children lock {:.3f} ms",
+                         nodesVisited, windowsCreated, windowsSkipped, castsAttempted, connectionsEstablished,
+                         connectionsSkipped,
+                         total.count(), traverse.count(), createWindow.count(), editorAdd.count(),
+                         connect.count(), childrenLock.count());
+    }
+  };
+
+#ifndef NO_LOAD_SAVE_JSON
+  /**
+   * Reads a graph file on the threadpool for
+   * WindowFactory::loadGraph. Same deal as CleanupFactory, the factory
+   * has to outlive it.
+   */
+
+  template <typename WindowList, typename WorkerThreadType>
+  class GraphLoadTask : public fr::RequirementsManager::TaskNode<WorkerThreadType> {
+    WindowFactory<WindowList> *_factory;
+    GraphLoad::PtrType _load;
+  public:
+    using Type = GraphLoadTask;
+    using Parent = fr::RequirementsManager::TaskNode<WorkerThreadType>;
+    using PtrType = std::shared_ptr<GraphLoadTask<WindowList, WorkerThreadType>>;
+    GraphLoadTask(WindowFactory<WindowList> *factory, GraphLoad::PtrType load) : _factory(factory), _load(std::move(load)) {
+    }
+
+    virtual ~GraphLoadTask() {}
+
+    void run() override {
+      _factory->readFile(_load);
+    }
+
+  };
+#endif
+
   /**
    * WindowFactory takes a graph, creates properly-connected
    * windows for that graph and adds them to the NodeEditorWindow.
+   *
+   * add only walks the graph and queues its nodes, so it's cheap to
+   * call from a loader thread. The windows get created and connected
+   * by materialize, which NodeEditorWindow calls once a frame on the
+   * UI thread with a window count and time budget. That keeps a big
+   * graph from freezing the UI while it comes in.
+   *
+   * Each graph added is remembered until closeGraph, which takes its
+   * windows back out of the editor and frees them.
    */
 
   template <typename WindowList>
   requires fr::types::IsUnique<WindowList>
   class WindowFactory {
-    // Map of node IDs in the graph
-    std::unordered_map<std::string, std::shared_ptr<fr::RequirementsManager::Node>> _nodeMap;
     NodeEditorWindow<WindowList> *_editorWindow;
     fr::RequirementsManager::GraphNodeFactory *_restNodeFactory;
     std::shared_ptr<fr::RequirementsManager::ThreadPool<fr::RequirementsManager::WorkerThread>> _threadpool;
 #ifndef NO_SQL
     std::unordered_map<std::string, std::shared_ptr<fr::RequirementsManager::PqNodeFactory<fr::RequirementsManager::WorkerThread>>> _factories;
+    // The graph each database load is adding its nodes to
+    std::mutex _factoryGraphsMutex;
+    std::unordered_map<std::string, GraphId> _factoryGraphs;
 #endif
-    // Track IDs we add so we can connect them later
-    std::mutex _addedIdsMutex;
-    std::vector<std::string> _addedIds;
-
-    // Handles establishing window connections. This gets called when all the windows
-    // have loaded in
-    void connect() {
-      for (auto id : _addedIds) {
-        auto window = _editorWindow->get(id);
-        std::cout << "Connectiong " << id << std::endl;
+    // Handles of the windows materialize created this time around,
+    // so it can connect them and file them under their graph
+    std::mutex _addedMutex;
+    std::vector<NodeHandle> _added;
+    std::vector<GraphId> _addedGraphs;
+    // Stats from the most recent load
+    std::mutex _statsMutex;
+    WindowFactoryStats _lastStats;
+
+    using Clock = std::chrono::steady_clock;
+
+    // A node waiting for a window, and the graph it came in with
+    struct PendingNode {
+      fr::RequirementsManager::Node::PtrType node;
+      GraphId graph;
+      GraphArena::PtrType arena;
+    };
+
+    // Everything closeGraph needs to take a graph apart
+    struct LoadedGraph {
+      std::string name;
+      // Name the caller gave add, without the node count
+      std::string label;
+      GraphArena::PtrType arena;
+      // Every node in the graph, windowed or not
+      std::vector<fr::RequirementsManager::Node::PtrType> nodes;
+      // The same nodes, so adding more to the graph can skip the ones
+      // it already has
+      std::unordered_set<const fr::RequirementsManager::Node *> members;
+      // The graph's windows. Nodes that were already open in the
+      // editor when the graph came in aren't in here.
+      std::vector<NodeHandle> handles;
+    };
+
+    std::mutex _graphsMutex;
+    std::map<GraphId, LoadedGraph> _graphs;
+    // Graph materialize is creating windows for, for add
+    GraphId _materializingGraph;
+
+    // Nodes waiting for windows
+    std::mutex _pendingMutex;
+    std::deque<PendingNode> _pending;
+    // Lets materialize skip the lock when there's nothing queued
+    std::atomic<bool> _hasPending;
+    // Progress for the current load. Reset when the queue drains.
+    std::atomic<size_t> _queuedTotal;
+    std::atomic<size_t> _materialized;
+    // Stats for the load in progress, under _statsMutex
+    WindowFactoryStats _currentStats;
+    Clock::time_point _loadStart;
+    uint64_t _loadLockStart;
+    bool _loading;
+    // Per-frame scratch for materialize, so it doesn't allocate
+    // once it's warmed up
+    std::vector<NodeHandle> _batch;
+
+    size_t _maxWindowsPerFrame;
+    std::chrono::microseconds _frameBudget;
+
+    // Files being read by loadGraph, and ones whose graph is still
+    // open so asking for them again doesn't read them again
+    std::mutex _loadsMutex;
+    std::vector<GraphLoad::PtrType> _loads;
+    // Loads still reading their file
+    std::atomic<size_t> _reading;
+
+    // Forget loads that are over: failed, cancelled, or whose graph
+    // has been closed. A load cancelled after it had already queued
+    // its graph gets the graph closed here. UI thread only.
+    void sweepLoads() {
+      std::vector<GraphId> cancelled;
+      {
+        std::lock_guard<std::mutex> lock(_loadsMutex);
+        if (_loads.empty()) {
+          return;
+        }
+        std::erase_if(_loads, [&](const GraphLoad::PtrType &load) {
+          switch (load->state()) {
+          case GraphLoad::State::Reading:
+            return false;
+          case GraphLoad::State::Queued:
+            if (load->cancelled()) {
+              cancelled.push_back(load->graph());
+              load->setState(GraphLoad::State::Cancelled);
+              return true;
+            }
+            return !hasGraph(load->graph());
+          default:
+            return true;
+          }
+        });
+      }
+      for (GraphId graph : cancelled) {
+        closeGraph(graph);
+      }
+    }
+
+    static std::string graphName(GraphId graph, const std::string &label, size_t nodes) {
+      if (label.empty()) {
+        return std::format("Graph {} ({} nodes)", graph, nodes);
+      }
+      return std::format("{} ({} nodes)", label, nodes);
+    }
+
+    // Queue nodes for windows in graph, and count them in the load
+    // that's in progress (starting one if there isn't).
+    void enqueue(std::vector<fr::RequirementsManager::Node::PtrType> &nodes, GraphId graph,
+                 const GraphArena::PtrType &arena, const WindowFactoryStats &stats, Clock::time_point start) {
+      {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        if (!_loading) {
+          _loading = true;
+          _currentStats = WindowFactoryStats();
+          _loadStart = start;
+          _loadLockStart = childrenLockNanos();
+        }
+        _currentStats += stats;
+      }
+      {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        for (auto &queued : nodes) {
+          _pending.push_back(PendingNode{std::move(queued), graph, arena});
+        }
+        _queuedTotal += nodes.size();
+        _hasPending.store(true, std::memory_order_release);
+      }
+      // The editor might be sleeping. It keeps drawing until we're
+      // done loading once it's up.
+      RenderWake::instance().request();
+    }
+
+    // Queue the nodes of open graphs that were showing in a closed
+    // graph's windows (the same file loaded twice, say), so they get
+    // windows of their own. released holds the closed windows' UUIDs.
+    void requeueShared(const std::unordered_set<std::string> &released) {
+      if (released.empty() || !_editorWindow) {
+        return;
+      }
+      NodeHandles &handles = *_editorWindow->getNodeHandles();
+      std::vector<std::tuple<GraphId, GraphArena::PtrType, std::vector<fr::RequirementsManager::Node::PtrType>>> shared;
+      {
+        std::lock_guard<std::mutex> lock(_graphsMutex);
+        for (const auto &[id, graph] : _graphs) {
+          std::vector<fr::RequirementsManager::Node::PtrType> nodes;
+          for (const auto &node : graph.nodes) {
+            // Releasing the handle forgot every object interned under it
+            if (handles.find(node) == invalidNodeHandle && released.contains(node->idString())) {
+              nodes.push_back(node);
+            }
+          }
+          if (!nodes.empty()) {
+            shared.emplace_back(id, graph.arena, std::move(nodes));
+          }
+        }
+      }
+      for (auto &[id, arena, nodes] : shared) {
+        FR_LOG_INFO(Factory, "Reopening {} nodes the closed graph was showing", nodes.size());
+        enqueue(nodes, id, arena, WindowFactoryStats(), Clock::now());
+      }
+    }
+
+    uint64_t childrenLockNanos() {
+      return _editorWindow ? _editorWindow->childrenLockNanos() : 0;
+    }
+
+    // Window for a neighbor of a node we're connecting, if it has
+    // one yet. Nodes without a handle haven't got a window either.
+    template <typename WindowType>
+    std::shared_ptr<WindowType> neighborWindow(NodeHandles &handles, const fr::RequirementsManager::Node::PtrType &node) {
+      return std::dynamic_pointer_cast<WindowType>(handles.window(handles.find(node)));
+    }
+
+    // Links source (on node) to target unless they're already
+    // linked. Checking first keeps an edge whose ends are both in
+    // the batch from getting a payload made for it twice.
+    void link(const NodeAnchor::PtrType &source, const fr::RequirementsManager::Node::PtrType &node,
+              AnchorType type, const NodeAnchor::PtrType &target, WindowFactoryStats &stats) {
+      if (target->connectedTo(source->nodeHandle())) {
+        stats.connectionsSkipped++;
+        return;
+      }
+      auto payload = makeArenaShared<NodeDragPayload>();
+      payload->dragSource = source;
+      payload->sourceNode = node;
+      payload->anchorType = type;
+      target->establishConnection(payload, false);
+      stats.connectionsEstablished++;
+    }
+
+    // Handles establishing window connections for the windows in
+    // batch, which only holds the windows materialize just made.
+    // Links are kept on both nodes, so connecting each new batch to
+    // whatever windows already exist picks up every edge once both
+    // ends have windows, and nothing older gets looked at again.
+    void connect(const std::vector<NodeHandle> &batch, WindowFactoryStats &stats) {
+      FR_PROFILE_SCOPE("WindowFactory::connect");
+      auto start = Clock::now();
+      NodeHandles &handles = *_editorWindow->getNodeHandles();
+      for (NodeHandle handle : batch) {
+        auto window = handles.window(handle);
+        FR_LOG_TRACE(Factory, "Connecting {}", handles.uuid(handle));
         if (!window) {
-          std::cout << "Error: Was not able to retrieve a window for " << id << std::endl;
+          FR_LOG_ERROR(Factory, "Was not able to retrieve a window for {}", handles.uuid(handle));
           continue;
         }
         auto isCommitable = std::dynamic_pointer_cast<CommitableNodeWindow>(window);
@@ -107,24 +426,15 @@ namespace fr::Imgui {
             auto parent = node->getChangeParent();
             auto child = node->getChangeChild();
             if (parent) {
-              auto changeParentWindow = dynamic_pointer_cast<CommitableNodeWindow>(_editorWindow->get(parent->idString()));
+              auto changeParentWindow = neighborWindow<CommitableNodeWindow>(handles, parent);
               if (changeParentWindow) {
-                // Create a drag payload to connect the windows
-                auto payload = std::make_shared<NodeDragPayload>();
-                payload->dragSource = isCommitable->_leftAnchor;
-                payload->sourceNode = node;
-                payload->anchorType = AnchorType::Left;
-                changeParentWindow->_rightAnchor->establishConnection(payload, false);
+                link(isCommitable->_leftAnchor, node, AnchorType::Left, changeParentWindow->_rightAnchor, stats);
               }
             }
             if (child) {
-              auto changeChildWindow = dynamic_pointer_cast<CommitableNodeWindow>(_editorWindow->get(child->idString()));
+              auto changeChildWindow = neighborWindow<CommitableNodeWindow>(handles, child);
               if (changeChildWindow) {
-                auto payload = std::make_shared<NodeDragPayload>();
-                payload->dragSource = isCommitable->_rightAnchor;
-                payload->sourceNode = node;
-                payload->anchorType = AnchorType::Right;
-                changeChildWindow->_leftAnchor->establishConnection(payload, false);
+                link(isCommitable->_rightAnchor, node, AnchorType::Right, changeChildWindow->_leftAnchor, stats);
               }
             }
           }
@@ -137,99 +447,662 @@ namespace fr::Imgui {
             // TODO: Should I throw if this is ever false? It should never happen.
             // Check node up and down lists
             for (auto upNode : node->up) {
-              auto upNodeWindow = dynamic_pointer_cast<NodeWindow>(_editorWindow->get(upNode->idString()));
+              auto upNodeWindow = neighborWindow<NodeWindow>(handles, upNode);
               if (upNodeWindow) {
-                auto payload = std::make_shared<NodeDragPayload>();
-                payload->dragSource = isNode->_upAnchor;
-                payload->sourceNode = node;
-                payload->anchorType = AnchorType::Up;
-                upNodeWindow->_downAnchor->establishConnection(payload, false);
+                link(isNode->_upAnchor, node, AnchorType::Up, upNodeWindow->_downAnchor, stats);
               }
             }
             for (auto downNode : node->down) {
-              auto downNodeWindow = dynamic_pointer_cast<NodeWindow>(_editorWindow->get(downNode->idString()));
+              auto downNodeWindow = neighborWindow<NodeWindow>(handles, downNode);
               if (downNodeWindow) {
-                auto payload = std::make_shared<NodeDragPayload>();
-                payload->dragSource = isNode->_downAnchor;
-                payload->sourceNode = node;
-                payload->anchorType = AnchorType::Down;
-                downNodeWindow->_upAnchor->establishConnection(payload, false);
+                link(isNode->_downAnchor, node, AnchorType::Down, downNodeWindow->_upAnchor, stats);
               }
             }
           }
         }
       }
+      stats.connect += Clock::now() - start;
     }
     
-    void add(const std::string& id , Window::PtrType window) {
+    // Files the windows created since the last call under their graph
+    // and connects them, making the links in arena. They all have to
+    // be from arena's graph. A link payload keeps the arena it was
+    // made in alive, so one graph's links in another graph's arena
+    // would hold on to that graph's memory after it's closed.
+    void connectAdded(GraphArena::PtrType arena, WindowFactoryStats &stats) {
+      {
+        std::lock_guard<std::mutex> lock(_addedMutex);
+        _batch.swap(_added);
+        _added.clear();
+        std::lock_guard<std::mutex> graphsLock(_graphsMutex);
+        for (size_t i = 0; i < _batch.size(); ++i) {
+          auto graph = _graphs.find(_addedGraphs[i]);
+          if (graph != _graphs.end()) {
+            graph->second.handles.push_back(_batch[i]);
+          }
+        }
+        _addedGraphs.clear();
+      }
+      ArenaScope scope(std::move(arena));
+      connect(_batch, stats);
+    }
+
+    void add(const fr::RequirementsManager::Node::PtrType &node, Window::PtrType window, WindowFactoryStats &stats) {
       if (_editorWindow) {
-        std::lock_guard<std::mutex> lock(_addedIdsMutex);
-        _editorWindow->add(id, window);
-        _addedIds.push_back(id);
+        auto start = Clock::now();
+        NodeHandles &handles = *_editorWindow->getNodeHandles();
+        NodeHandle handle = handles.intern(node);
+        std::lock_guard<std::mutex> lock(_addedMutex);
+        // Like the editor's add, the first window for a node wins
+        if (!handles.window(handle)) {
+          _editorWindow->add(handles.uuid(handle), window);
+          handles.setWindow(handle, window);
+          _added.push_back(handle);
+          _addedGraphs.push_back(_materializingGraph);
+        }
+        stats.editorAdd += Clock::now() - start;
        }
     }    
     
-    template <typename Windows>
-    requires fr::types::IsUnique<Windows>
-    void createWindow(std::shared_ptr<fr::RequirementsManager::Node> node) {
-      // Find node type
-      using CurrentWindowNodeType = Windows::head::type;
-      if constexpr (!std::is_void_v<CurrentWindowNodeType>) {
-        // Try casting node to current node type
-        using NodeType = Registration::Record<CurrentWindowNodeType>::NodeType;
-        auto n = std::dynamic_pointer_cast<NodeType>(node);
-        if (n) {
-          // This is the correct node type
-          using WindowNodeType = Registration::Record<CurrentWindowNodeType>::Type;
-          auto window = std::make_shared<WindowNodeType>();
-          window->setStartingSize(Registration::Record<WindowNodeType>::startingSize());
-          window->addNode(node);
-          window->init();
-          add(node->idString(), window);
-          // If this is a Graph Window, add our REST factory to it so it can
-          // save to REST
-          if constexpr (std::is_same_v<WindowNodeType, GraphNodeWindow>) {
-            window->setFactory(_restNodeFactory);
-          }
-        } else {
-          if constexpr (!std::is_void_v<typename Windows::tail::head::type>) {
-            this->createWindow<typename Windows::tail>(node);
+    // Creates node's window from the WindowTable entry for its type.
+    // Node types without an entry of their own fall back to trying
+    // each entry's NodeType in typelist order. Nodes that already
+    // have a window are skipped before anything gets built, since
+    // add would only throw the new one away and its arena wouldn't
+    // give the memory back.
+    void createWindow(std::shared_ptr<fr::RequirementsManager::Node> node, WindowFactoryStats &stats) {
+      if (!node) {
+        return;
+      }
+      if (_editorWindow) {
+        NodeHandles &handles = *_editorWindow->getNodeHandles();
+        if (handles.window(handles.intern(node))) {
+          stats.windowsSkipped++;
+          return;
+        }
+      }
+      const auto &table = Registration::WindowTable<WindowList>::instance();
+      const Registration::WindowEntry *entry = table.find(typeid(*node));
+      if (!entry) {
+        for (const Registration::WindowEntry &candidate : table.entries()) {
+          stats.castsAttempted++;
+          if (candidate.accepts(node)) {
+            entry = &candidate;
+            break;
           }
         }
       }
+      if (!entry) {
+        FR_LOG_WARN(Factory, "No window type for node {}", node->idString());
+        return;
+      }
+      auto start = Clock::now();
+      auto window = entry->forNode(node, _restNodeFactory);
+      stats.createWindow += Clock::now() - start;
+      stats.windowsCreated++;
+      add(node, window, stats);
+      FR_PROFILE_COUNT("Windows created", 1);
     }
     
+    // True if node or anything it links to has a frozen window. A
+    // save freezes the window of every node it reads, and closing a
+    // graph writes to its nodes and to their neighbors.
+    bool frozenNear(NodeHandles &handles, const fr::RequirementsManager::Node::PtrType &node) {
+      auto frozen = [&](const fr::RequirementsManager::Node::PtrType &other) {
+        if (!other) {
+          return false;
+        }
+        auto window = std::dynamic_pointer_cast<NodeWindow>(handles.window(handles.find(other)));
+        return window && window->frozen();
+      };
+      if (frozen(node)) {
+        return true;
+      }
+      for (const auto &upNode : node->up) {
+        if (frozen(upNode)) {
+          return true;
+        }
+      }
+      for (const auto &downNode : node->down) {
+        if (frozen(downNode)) {
+          return true;
+        }
+      }
+      if (auto commitable = std::dynamic_pointer_cast<fr::RequirementsManager::CommitableNode>(node)) {
+        return frozen(commitable->getChangeParent()) || frozen(commitable->getChangeChild());
+      }
+      return false;
+    }
+
+    // Clears node's change parent and child, and their links back to
+    // it. Returns false if it had some and they couldn't be cleared.
+    template <typename CommitableT>
+    bool cutChangeLinks(CommitableT &node) {
+      auto parent = node.getChangeParent();
+      auto child = node.getChangeChild();
+      if constexpr (has_change_setters<CommitableT>) {
+        if (parent) {
+          parent->setChangeChild(nullptr);
+        }
+        if (child) {
+          child->setChangeParent(nullptr);
+        }
+        node.setChangeParent(nullptr);
+        node.setChangeChild(nullptr);
+        return true;
+      } else {
+        return !parent && !child;
+      }
+    }
+
+    // Cuts every link that would keep the nodes in closing alive:
+    // their up, down and change chain links, and the links back to
+    // them from nodes in graphs that are still open. Nodes in nodes
+    // that aren't in closing belong to another graph too and are
+    // left alone. Returns the number of links that were cut from
+    // open graphs.
+    size_t unlinkNodes(const std::vector<fr::RequirementsManager::Node::PtrType> &nodes,
+                       const std::unordered_set<const fr::RequirementsManager::Node *> &closing,
+                       const std::string &name) {
+      size_t crossGraph = 0;
+      bool chainsLeft = false;
+      for (const auto &node : nodes) {
+        if (!closing.contains(node.get())) {
+          continue;
+        }
+        for (const auto &upNode : node->up) {
+          if (upNode && !closing.contains(upNode.get())) {
+            upNode->removeDown(node);
+            crossGraph++;
+          }
+        }
+        for (const auto &downNode : node->down) {
+          if (downNode && !closing.contains(downNode.get())) {
+            downNode->removeUp(node);
+            crossGraph++;
+          }
+        }
+        node->up.clear();
+        node->down.clear();
+        if (auto commitable = std::dynamic_pointer_cast<fr::RequirementsManager::CommitableNode>(node)) {
+          chainsLeft = !cutChangeLinks(*commitable) || chainsLeft;
+        }
+      }
+      if (chainsLeft) {
+        FR_LOG_WARN(Factory, "This RequirementsManager can't clear change chains, {} may not be freed", name);
+      }
+      return crossGraph;
+    }
+
   public:
 
-    WindowFactory() : _editorWindow(nullptr), _restNodeFactory(nullptr) {
+    // Default materialize budget. Enough to bring in a few thousand
+    // windows a second without dropping a 60 fps frame.
+    static constexpr size_t defaultMaxWindowsPerFrame = 64;
+    static constexpr std::chrono::microseconds defaultFrameBudget{4000};
+    // First block of a graph's arena is sized from its node count.
+    // A window and its anchors come to a kilobyte or two.
+    static constexpr size_t arenaBytesPerNode = 2048;
+    static constexpr size_t maxInitialArenaBytes = 4 * 1024 * 1024;
+
+    WindowFactory() : _editorWindow(nullptr),
+                      _restNodeFactory(nullptr),
+                      _materializingGraph(invalidGraphId),
+                      _hasPending(false),
+                      _queuedTotal(0),
+                      _materialized(0),
+                      _loadLockStart(0),
+                      _loading(false),
+                      _maxWindowsPerFrame(defaultMaxWindowsPerFrame),
+                      _frameBudget(defaultFrameBudget),
+                      _reading(0) {
       _threadpool = std::make_shared<fr::RequirementsManager::ThreadPool<fr::RequirementsManager::WorkerThread>>();
       _threadpool->startThreads(4);
     }
     
     ~WindowFactory() {
+      {
+        // Don't make the join wait for a big file to finish parsing
+        std::lock_guard<std::mutex> lock(_loadsMutex);
+        for (auto &load : _loads) {
+          load->cancel();
+        }
+      }
       _threadpool->shutdown();
       _threadpool->join();
     }
 
-    // Add an editor window so we can create windows with it
+    // Add an editor window so we can create windows with it. The
+    // editor materializes our queued nodes every frame from then on.
     void addEditorWindow(NodeEditorWindow<WindowList> *editor) {
       _editorWindow = editor;
+      editor->addFactory(this);
     }
 
     void addNodeFactory(fr::RequirementsManager::GraphNodeFactory *factory) {
       _restNodeFactory = factory;
     }
 
+    // Set how much work materialize does per call. It stops after
+    // maxWindows windows or once budget has run out, whichever is first.
+    void setFrameBudget(size_t maxWindows, std::chrono::microseconds budget) {
+      _maxWindowsPerFrame = std::max<size_t>(1, maxWindows);
+      _frameBudget = budget;
+    }
+
     // Add a graph to the factory. WindowList is a list of supported windows.
-    // This function will read the registration records and try to find the
-    // correct window to create based on the NodeType in the registration
-    // record.
-    void add(std::shared_ptr<fr::RequirementsManager::Node> node) {
-      // If this is a graph window, set its rest node factory
+    // This queues the graph's nodes; materialize will read the registration
+    // records and try to find the correct window to create based on the
+    // NodeType in the registration record. Safe to call from any thread.
+    //
+    // Each graph gets its own GraphArena. Its windows, their anchors and
+    // the payloads linking them all get made in it.
+    //
+    // name is what the editor's menus call the graph. Returns an ID to
+    // close the graph with, or invalidGraphId if there was nothing to
+    // add.
+    GraphId add(std::shared_ptr<fr::RequirementsManager::Node> node, const std::string &name = "") {
+      FR_PROFILE_SCOPE("WindowFactory::add");
+      WindowFactoryStats stats;
+      auto start = Clock::now();
+      std::vector<fr::RequirementsManager::Node::PtrType> nodes;
       node->traverse([&](fr::RequirementsManager::Node::PtrType node) {
-        this->createWindow<WindowList>(node);
+        stats.nodesVisited++;
+        nodes.push_back(node);
       });
-      connect();
+      stats.traverse = Clock::now() - start;
+      if (nodes.empty()) {
+        return invalidGraphId;
+      }
+      auto arena = std::make_shared<GraphArena>(std::min(nodes.size() * arenaBytesPerNode, maxInitialArenaBytes));
+      static std::atomic<GraphId> nextGraphId{1};
+      GraphId graph = nextGraphId.fetch_add(1, std::memory_order_relaxed);
+      {
+        std::lock_guard<std::mutex> lock(_graphsMutex);
+        LoadedGraph &loaded = _graphs[graph];
+        loaded.label = name;
+        loaded.name = graphName(graph, name, nodes.size());
+        loaded.arena = arena;
+        loaded.nodes = nodes;
+        loaded.members.reserve(nodes.size());
+        for (const auto &member : nodes) {
+          loaded.members.insert(member.get());
+        }
+      }
+      enqueue(nodes, graph, arena, stats, start);
+      return graph;
+    }
+
+    // Add node, and whatever it reaches that isn't in graph yet, to
+    // a graph add already made. A node graph already has is skipped
+    // without walking it, since everything it reaches came in with
+    // it. For loaders that hand a graph over a node at a time.
+    // Returns false if graph isn't open.
+    bool add(const fr::RequirementsManager::Node::PtrType &node, GraphId graph) {
+      FR_PROFILE_SCOPE("WindowFactory::add");
+      if (!node) {
+        return false;
+      }
+      {
+        std::lock_guard<std::mutex> lock(_graphsMutex);
+        auto found = _graphs.find(graph);
+        if (found == _graphs.end()) {
+          return false;
+        }
+        if (found->second.members.contains(node.get())) {
+          return true;
+        }
+      }
+      WindowFactoryStats stats;
+      auto start = Clock::now();
+      std::vector<fr::RequirementsManager::Node::PtrType> nodes;
+      node->traverse([&](fr::RequirementsManager::Node::PtrType node) {
+        stats.nodesVisited++;
+        nodes.push_back(node);
+      });
+      stats.traverse = Clock::now() - start;
+      GraphArena::PtrType arena;
+      {
+        std::lock_guard<std::mutex> lock(_graphsMutex);
+        auto found = _graphs.find(graph);
+        if (found == _graphs.end()) {
+          return false;
+        }
+        LoadedGraph &loaded = found->second;
+        std::erase_if(nodes, [&](const fr::RequirementsManager::Node::PtrType &reached) {
+          return !loaded.members.insert(reached.get()).second;
+        });
+        loaded.nodes.insert(loaded.nodes.end(), nodes.begin(), nodes.end());
+        loaded.name = graphName(graph, loaded.label, loaded.nodes.size());
+        arena = loaded.arena;
+      }
+      if (!nodes.empty()) {
+        enqueue(nodes, graph, arena, stats, start);
+      }
+      return true;
+    }
+
+    // Take a graph from add back out of the editor. Any of its nodes
+    // still queued are dropped, its windows are unlinked from
+    // everything (other graphs included) and removed, and every link
+    // to its nodes is cut so nothing keeps them alive. Nodes in
+    // still-open graphs lose their links to it too, and ones it was
+    // showing for them (same UUID) get queued for windows of their own.
+    // The memory comes back when the editor applies the removes at
+    // the start of the next frame. Call from the UI thread. Returns
+    // false if this factory doesn't have the graph, or if a save has
+    // frozen any of its nodes or anything linked to them.
+    bool closeGraph(GraphId id) {
+      FR_PROFILE_SCOPE("WindowFactory::closeGraph");
+      LoadedGraph graph;
+      std::unordered_set<const fr::RequirementsManager::Node *> closing;
+      std::unordered_set<std::string> released;
+      {
+        std::lock_guard<std::mutex> lock(_graphsMutex);
+        auto found = _graphs.find(id);
+        if (found == _graphs.end()) {
+          return false;
+        }
+        // Cutting the links under a save that's still reading them
+        // would pull the graph out from under it. That includes saves
+        // of other graphs that reach this one through a link.
+        if (_editorWindow) {
+          NodeHandles &handles = *_editorWindow->getNodeHandles();
+          for (const auto &node : found->second.nodes) {
+            if (frozenNear(handles, node)) {
+              FR_LOG_WARN(Factory, "Can't close {} while it's being saved", found->second.name);
+              return false;
+            }
+          }
+        }
+        graph = std::move(found->second);
+        _graphs.erase(found);
+        // A node that's in another open graph as well stays put
+        closing.reserve(graph.nodes.size());
+        for (const auto &node : graph.nodes) {
+          closing.insert(node.get());
+        }
+        for (const auto &[otherId, other] : _graphs) {
+          for (const auto &node : other.nodes) {
+            closing.erase(node.get());
+          }
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        size_t dropped = std::erase_if(_pending, [id](const PendingNode &pending) {
+          return pending.graph == id;
+        });
+        // Count them as done so the progress bar still adds up
+        _materialized += dropped;
+      }
+      if (_editorWindow) {
+        NodeHandles &handles = *_editorWindow->getNodeHandles();
+        // Unlink everything first, so no window outside the graph is
+        // left pointing at one that's going away
+        for (NodeHandle handle : graph.handles) {
+          if (auto window = std::dynamic_pointer_cast<NodeWindow>(handles.window(handle))) {
+            window->close();
+          }
+        }
+        for (NodeHandle handle : graph.handles) {
+          released.insert(handles.uuid(handle));
+          _editorWindow->remove(handles.uuid(handle));
+          handles.release(handle);
+        }
+      }
+      size_t crossGraph = unlinkNodes(graph.nodes, closing, graph.name);
+      FR_LOG_INFO(Factory, "Closed {}, cut {} links from other graphs", graph.name, crossGraph);
+      requeueShared(released);
+      RenderWake::instance().request();
+      return true;
+    }
+
+    // The graphs this factory has open, oldest first
+    std::vector<GraphInfo> graphs() {
+      std::vector<GraphInfo> infos;
+      std::lock_guard<std::mutex> lock(_graphsMutex);
+      infos.reserve(_graphs.size());
+      for (const auto &[id, graph] : _graphs) {
+        infos.push_back(GraphInfo{id, graph.name});
+      }
+      return infos;
+    }
+
+    bool hasGraphs() {
+      std::lock_guard<std::mutex> lock(_graphsMutex);
+      return !_graphs.empty();
+    }
+
+    bool hasGraph(GraphId id) {
+      std::lock_guard<std::mutex> lock(_graphsMutex);
+      return _graphs.contains(id);
+    }
+
+#ifndef NO_LOAD_SAVE_JSON
+    // Read a graph file on the threadpool and add it once it's
+    // parsed. The extension picks the format, .frg for binary (see
+    // GraphFile.h) and JSON for anything else. Returns right away.
+    // The returned load tracks how far the read has got and can be
+    // cancelled (see cancelLoading).
+    //
+    // If the same file is already being read, or its graph is still
+    // open and the file hasn't changed, that load is returned instead
+    // of reading the file again.
+    GraphLoad::PtrType loadGraph(const std::string &path) {
+      std::lock_guard<std::mutex> lock(_loadsMutex);
+      for (const auto &load : _loads) {
+        if (load->path() != path || load->cancelled() || !load->current()) {
+          continue;
+        }
+        auto state = load->state();
+        if (state == GraphLoad::State::Reading ||
+            (state == GraphLoad::State::Queued && hasGraph(load->graph()))) {
+          FR_LOG_INFO(Factory, "{} is already open", path);
+          return load;
+        }
+      }
+      auto load = std::make_shared<GraphLoad>(path);
+      _loads.push_back(load);
+      _reading++;
+      _threadpool->enqueue(std::make_shared<GraphLoadTask<WindowList, fr::RequirementsManager::WorkerThread>>(this, load));
+      RenderWake::instance().request();
+      return load;
+    }
+
+    // GraphLoadTask runs this on the threadpool
+    void readFile(const GraphLoad::PtrType &load) {
+      FR_PROFILE_SCOPE("WindowFactory::readFile");
+      auto start = Clock::now();
+      fr::RequirementsManager::Node::PtrType root;
+      std::string error;
+      auto parse = [&](std::streambuf &buffer, GraphFormat format) {
+        std::istream in(&buffer);
+        try {
+          root = readGraph(in, format);
+        } catch (const std::exception &e) {
+          error = e.what();
+        }
+      };
+      if (graphFormatFor(load->path()) == GraphFormat::Binary) {
+        // Binary files are mapped rather than read through a buffer
+        MappedGraphStreambuf buffer(load->path(), load.get());
+        if (!buffer.is_open()) {
+          error = "could not map the file: " + buffer.error();
+        } else {
+          parse(buffer, GraphFormat::Binary);
+        }
+      } else {
+        GraphLoadStreambuf buffer(*load);
+        if (!buffer.is_open()) {
+          error = "could not open the file";
+        } else {
+          parse(buffer, GraphFormat::Json);
+        }
+      }
+      if (load->cancelled()) {
+        // The reader running out of input early is how a cancel
+        // looks from here, so whatever error that made doesn't count
+        load->setState(GraphLoad::State::Cancelled);
+        FR_LOG_INFO(Factory, "Cancelled reading {}", load->path());
+      } else if (!error.empty() || !root) {
+        if (error.empty()) {
+          error = "no graph in the file";
+        }
+        FR_LOG_WARN(Factory, "Could not load {}: {}", load->path(), error);
+        load->fail(error);
+      } else {
+        FR_LOG_INFO(Factory, "Read {} in {:.3f} ms", load->path(),
+                    std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        load->setGraph(add(root, load->name()));
+        load->setState(GraphLoad::State::Queued);
+      }
+      _reading--;
+      RenderWake::instance().request();
+    }
+
+    // Loads still reading their file, for progress
+    std::vector<GraphLoad::PtrType> readingLoads() {
+      std::vector<GraphLoad::PtrType> reading;
+      std::lock_guard<std::mutex> lock(_loadsMutex);
+      for (const auto &load : _loads) {
+        if (load->state() == GraphLoad::State::Reading) {
+          reading.push_back(load);
+        }
+      }
+      return reading;
+    }
+#endif
+
+    // Stop everything that's coming in. Files still being read are
+    // cancelled, and graphs that still have nodes without windows are
+    // closed, the windows they've got so far included. Call from the
+    // UI thread.
+    void cancelLoading() {
+      {
+        std::lock_guard<std::mutex> lock(_loadsMutex);
+        for (auto &load : _loads) {
+          if (load->state() == GraphLoad::State::Reading) {
+            load->cancel();
+          }
+        }
+      }
+      std::vector<GraphId> incoming;
+      {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        for (const auto &pending : _pending) {
+          if (incoming.empty() || incoming.back() != pending.graph) {
+            incoming.push_back(pending.graph);
+          }
+        }
+      }
+      std::sort(incoming.begin(), incoming.end());
+      incoming.erase(std::unique(incoming.begin(), incoming.end()), incoming.end());
+      for (GraphId graph : incoming) {
+        closeGraph(graph);
+      }
+    }
+
+    // Create and connect windows for queued nodes, within the frame
+    // budget. Call from the UI thread. Returns the number of nodes
+    // taken off the queue.
+    size_t materialize() {
+      sweepLoads();
+      return materialize(_maxWindowsPerFrame, _frameBudget);
+    }
+
+    size_t materialize(size_t maxWindows, std::chrono::microseconds budget) {
+      if (!_hasPending.load(std::memory_order_acquire)) {
+        return 0;
+      }
+      FR_PROFILE_SCOPE("WindowFactory::materialize");
+      WindowFactoryStats stats;
+      auto start = Clock::now();
+
+      size_t taken = 0;
+      bool drained = false;
+      // Arena of the graph we're creating windows for
+      GraphArena::PtrType arena;
+      while (taken < maxWindows) {
+        PendingNode pending;
+        {
+          std::lock_guard<std::mutex> lock(_pendingMutex);
+          if (_pending.empty()) {
+            drained = true;
+            break;
+          }
+          pending = std::move(_pending.front());
+          _pending.pop_front();
+        }
+        if (arena && pending.graph != _materializingGraph) {
+          // Connect what the last graph got before starting on the
+          // next one, so its links go in its own arena
+          connectAdded(std::move(arena), stats);
+        }
+        arena = std::move(pending.arena);
+        _materializingGraph = pending.graph;
+        {
+          ArenaScope scope(arena);
+          this->createWindow(pending.node, stats);
+        }
+        ++taken;
+        if (Clock::now() - start >= budget) {
+          break;
+        }
+      }
+      _materialized += taken;
+      connectAdded(std::move(arena), stats);
+
+      if (!drained) {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        drained = _pending.empty();
+      }
+      std::lock_guard<std::mutex> lock(_statsMutex);
+      _currentStats += stats;
+      if (drained) {
+        std::lock_guard<std::mutex> pendingLock(_pendingMutex);
+        // Something could have been queued since we looked
+        if (_pending.empty()) {
+          _hasPending.store(false, std::memory_order_release);
+          _queuedTotal = 0;
+          _materialized = 0;
+          _loading = false;
+          _currentStats.total = Clock::now() - _loadStart;
+          _currentStats.childrenLock = std::chrono::nanoseconds(childrenLockNanos() - _loadLockStart);
+          FR_LOG_INFO(Factory, "WindowFactory load: {}", _currentStats.toString());
+          _lastStats = _currentStats;
+        }
+      }
+      return taken;
+    }
+
+    // Materialize everything that's queued right now, ignoring the
+    // frame budget. For loads that don't care about the UI, like the
+    // benchmark.
+    void materializeAll() {
+      while (_hasPending.load(std::memory_order_acquire)) {
+        // A day is as good as no limit, and doesn't overflow when it
+        // gets converted to nanoseconds
+        materialize(std::numeric_limits<size_t>::max(), std::chrono::hours(24));
+      }
+    }
+
+    // True while there are queued nodes without windows or files
+    // still being read
+    bool loading() const {
+      return _hasPending.load(std::memory_order_acquire) || _reading.load(std::memory_order_acquire) > 0;
+    }
+
+    // How far along the current load is, in nodes
+    void progress(size_t &done, size_t &total) const {
+      done = _materialized.load(std::memory_order_relaxed);
+      total = _queuedTotal.load(std::memory_order_relaxed);
+    }
+
+    // Stats from the most recently finished load
+    WindowFactoryStats lastStats() {
+      std::lock_guard<std::mutex> lock(_statsMutex);
+      return _lastStats;
     }
 
 #ifdef NO_SQL
@@ -245,16 +1118,30 @@ namespace fr::Imgui {
 #ifndef NO_SQL
     void erase(const std::string& uuid) {
       _factories.erase(uuid);
+      std::lock_guard<std::mutex> lock(_factoryGraphsMutex);
+      _factoryGraphs.erase(uuid);
     }
 
     void load(const std::string& uuid) {
       if (!_factories.contains(uuid)) {
         _factories[uuid] = std::make_shared<fr::RequirementsManager::PqNodeFactory<fr::RequirementsManager::WorkerThread>>(uuid);
         _factories[uuid]->loaded.connect([&](const std::string& uuid, fr::RequirementsManager::Node::PtrType node){
-          this->add(node);
+          // Every node from this load goes in one graph. Nodes an
+          // earlier one already reached aren't walked or queued again.
+          std::lock_guard<std::mutex> lock(_factoryGraphsMutex);
+          auto graph = _factoryGraphs.find(uuid);
+          if (graph == _factoryGraphs.end() || !this->add(node, graph->second)) {
+            GraphId added = this->add(node, uuid);
+            if (added != invalidGraphId) {
+              _factoryGraphs[uuid] = added;
+            }
+          }
         });
         _factories[uuid]->done.connect([&](const std::string& uuid){
-          connect();
+          // Nothing to connect here. materialize connects each batch of
+          // windows as it creates them, and most of this graph is
+          // probably still queued anyway.
+
           // Enqueue a cleaner to run once this signal handler returns
 
           // TODO: If this runs before the callback returns, this can cause a crash.
@@ -42,20 +42,22 @@ namespace fr::Imgui {
     fr::RequirementsManager::GraphNodeLocator _locator;
     fr::Imgui::WindowFactory<WindowList> _factory;
 
-    std::string _tableName;
-    std::string _uuidColumn;
-    std::string _titleColumn;
-    std::string _load;
+    // Widget labels. ImGui scopes these to this window, so they're
+    // literals rather than getUniqueLabel strings.
+    const char *_tableName;
+    const char *_uuidColumn;
+    const char *_titleColumn;
+    const char *_load;
   public:
     using Parent = Window;
     using Type = WindowFactoryWindow;
     using PtrType = std::shared_ptr<Type>;    
     
     WindowFactoryWindow(const std::string& label = "Load Graph") : Parent(label), _show(false), _displayWindow(false) {
-      _tableName = getUniqueLabel("##LoadGraphTable");
-      _uuidColumn = getUniqueLabel("UUID");
-      _titleColumn = getUniqueLabel("Title");
-      _load = getUniqueLabel("Load");
+      _tableName = "##LoadGraphTable";
+      _uuidColumn = "UUID";
+      _titleColumn = "Title";
+      _load = "Load";
     }
     virtual ~WindowFactoryWindow() {}
 
@@ -85,25 +87,27 @@ namespace fr::Imgui {
     void begin() override {
       if (_displayWindow) {
         Parent::begin();
-        if (ImGui::BeginTable(_tableName.c_str(), 3)) {
-          ImGui::TableSetupColumn(_load.c_str());
-          ImGui::TableSetupColumn(_uuidColumn.c_str());
-          ImGui::TableSetupColumn(_titleColumn.c_str());
+        if (ImGui::BeginTable(_tableName, 3)) {
+          ImGui::TableSetupColumn(_load);
+          ImGui::TableSetupColumn(_uuidColumn);
+          ImGui::TableSetupColumn(_titleColumn);
           ImGui::TableHeadersRow();
           
           // Each node in locator.nodes is a row
-          for(auto [uuid,title] : _locator.nodes) {
+          for (const auto &[uuid, title] : _locator.nodes) {
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
-            std::string loadButton("Load##");
-            loadButton.append(uuid);
-            if (ImGui::Button(loadButton.c_str())) {
+            // Scope the button ID by uuid rather than building a
+            // "Load##uuid" string for every row every frame
+            ImGui::PushID(uuid.c_str());
+            if (ImGui::Button("Load")) {
               _factory.load(uuid);
             }
+            ImGui::PopID();
             ImGui::TableNextColumn();
-            ImGui::Text(uuid.c_str());
+            ImGui::TextUnformatted(uuid.c_str());
             ImGui::TableNextColumn();
-            ImGui::Text(title.c_str());
+            ImGui::TextUnformatted(title.c_str());
           }
           
           ImGui::EndTable();
@@ -0,0 +1,188 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fr/Imgui/GraphArena.h>
+#include <fr/Imgui/Registration.h>
+#include <fr/types/Typelist.h>
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace fr::RequirementsManager {
+  class GraphNodeFactory;
+  class Node;
+}
+
+namespace fr::Imgui {
+  class NodeWindow;
+}
+
+namespace fr::Imgui::Registration {
+
+  using NodePtr = std::shared_ptr<fr::RequirementsManager::Node>;
+
+  /**
+   * What a WindowTable knows about one window type in its typelist.
+   * The function pointers are instantiated for that window type, so
+   * calling one doesn't have to work out which type it's for.
+   */
+
+  struct WindowEntry {
+    const char *name;
+    const char *topMenuName;
+    // typeid of the Record's NodeType
+    std::type_index nodeType;
+    // A new window with a new node, for the menus
+    std::shared_ptr<NodeWindow> (*create)(fr::RequirementsManager::GraphNodeFactory *factory);
+    // A window for a node that's already there, for WindowFactory
+    std::shared_ptr<NodeWindow> (*forNode)(const NodePtr &node,
+                                           fr::RequirementsManager::GraphNodeFactory *factory);
+    // dynamic_cast check against the NodeType, for node types that
+    // aren't in the table themselves
+    bool (*accepts)(const NodePtr &node);
+  };
+
+  template <typename WindowType>
+  std::shared_ptr<NodeWindow> newWindow(fr::RequirementsManager::GraphNodeFactory *factory) {
+    auto window = std::make_shared<WindowType>();
+    window->init();
+    // Graph windows need to have their GraphNodeFactory set so they can
+    // save to REST
+    if constexpr (std::is_same_v<GraphNodeWindow, WindowType>) {
+      window->setFactory(factory);
+    }
+    auto startingSize = Record<WindowType>::startingSize();
+    window->setStartingSize(startingSize.x, startingSize.y);
+    Record<WindowType>::init(window);
+    return window;
+  }
+
+  /**
+   * createWindow creates a window of WindowType and adds it
+   * to an Editor of EditorType.
+   */
+
+  template <typename EditorType, typename WindowType>
+  requires has_init<WindowType> && has_add<EditorType>
+  void createWindow(EditorType& editor) {
+    addWindow(editor, newWindow<WindowType>(editor.getGraphNodeFactory()));
+  }
+
+  template <typename WindowType>
+  std::shared_ptr<NodeWindow> windowForNode(const NodePtr &node,
+                                            fr::RequirementsManager::GraphNodeFactory *factory) {
+    // Loaded graphs put their windows in the graph's arena
+    auto window = makeArenaShared<WindowType>();
+    window->setStartingSize(Record<WindowType>::startingSize());
+    window->addNode(node);
+    window->init();
+    if constexpr (std::is_same_v<GraphNodeWindow, WindowType>) {
+      window->setFactory(factory);
+    }
+    return window;
+  }
+
+  template <typename WindowType>
+  bool acceptsNode(const NodePtr &node) {
+    return static_cast<bool>(std::dynamic_pointer_cast<typename Record<WindowType>::NodeType>(node));
+  }
+
+  // Index of the first window in Windows whose NodeType NodeType
+  // converts to. That's the one the old dynamic_cast walk down the
+  // typelist would have stopped at for a node of exactly NodeType.
+  template <typename Windows, typename NodeType>
+  constexpr size_t firstAccepting(size_t index = 0) {
+    using Current = Windows::head::type;
+    if constexpr (std::is_void_v<Current>) {
+      return index;
+    } else if constexpr (std::is_convertible_v<NodeType *, typename Record<Current>::NodeType *>) {
+      return index;
+    } else {
+      return firstAccepting<typename Windows::tail, NodeType>(index + 1);
+    }
+  }
+
+  /**
+   * Table of every window type in List, built once from the
+   * typelist. WindowFactory finds the window for a node by looking
+   * up typeid(*node), one hash lookup instead of a dynamic_cast per
+   * window type until one works. NodeEditorWindow builds its menus
+   * from the same entries, so a new window type only has to go in
+   * the typelist (and have a Record).
+   *
+   * A node of a type with no entry of its own (a subclass of a
+   * registered node type, say) has to be matched with accepts, in
+   * typelist order. find returns null for those.
+   *
+   * Read only once it's built, so any thread can use it.
+   */
+
+  template <typename List>
+  requires fr::types::IsUnique<List>
+  class WindowTable {
+    std::vector<WindowEntry> _entries;
+    // Node type to index in _entries
+    std::unordered_map<std::type_index, size_t> _byNodeType;
+
+    template <typename Windows>
+    void addEntries() {
+      using Current = Windows::head::type;
+      if constexpr (!std::is_void_v<Current>) {
+        using NodeType = Record<Current>::NodeType;
+        _entries.push_back(WindowEntry{Record<Current>::name,
+                                       Record<Current>::topMenuName,
+                                       std::type_index(typeid(NodeType)),
+                                       &newWindow<Current>,
+                                       &windowForNode<Current>,
+                                       &acceptsNode<Current>});
+        _byNodeType.emplace(std::type_index(typeid(NodeType)), firstAccepting<List, NodeType>());
+        addEntries<typename Windows::tail>();
+      }
+    }
+
+    WindowTable() {
+      addEntries<List>();
+    }
+
+  public:
+    static const WindowTable &instance() {
+      static const WindowTable table;
+      return table;
+    }
+
+    // Entries in typelist order
+    const std::vector<WindowEntry> &entries() const {
+      return _entries;
+    }
+
+    // Entry for a node whose dynamic type is exactly nodeType, or
+    // null if there isn't one
+    const WindowEntry *find(const std::type_info &nodeType) const {
+      auto found = _byNodeType.find(std::type_index(nodeType));
+      if (found == _byNodeType.end()) {
+        return nullptr;
+      }
+      return &_entries[found->second];
+    }
+  };
+
+}
@@ -15,6 +15,11 @@
  */
 
 #pragma once
+#ifndef NO_LOAD_SAVE_JSON
+// Has to come before any node header so the node types get bound to
+// the binary archive as well as the JSON one
+#include <fr/Imgui/GraphFile.h>
+#endif
 #include <fr/Imgui/AllWindows.h>
 #include <fr/Imgui/Registration.h>
 #include <fr/Imgui/ActorWindow.h>
@@ -34,6 +39,8 @@
 #include <fr/Imgui/OrganizationWindow.h>
 #include <fr/Imgui/PersonWindow.h>
 #include <fr/Imgui/PhoneNumberWindow.h>
+#include <fr/Imgui/Profiler.h>
+#include <fr/Imgui/ProfilerWindow.h>
 #include <fr/Imgui/ProductWindow.h>
 #include <fr/Imgui/ProjectWindow.h>
 #include <fr/Imgui/PurposeWindow.h>
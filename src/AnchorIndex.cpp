@@ -0,0 +1,102 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/AnchorIndex.h>
+#include <fr/Imgui/NodeAnchor.h>
+#include <fr/Imgui/Profiler.h>
+#include <cmath>
+
+namespace fr::Imgui {
+
+  int32_t AnchorIndex::cellCoordinate(float value) {
+    return static_cast<int32_t>(std::floor(value / cellSize));
+  }
+
+  void AnchorIndex::erase(NodeAnchor *anchor, uint64_t key) {
+    auto cell = _cells.find(key);
+    if (cell == _cells.end()) {
+      return;
+    }
+    auto &entries = cell->second;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].anchor == anchor) {
+        entries[i] = std::move(entries.back());
+        entries.pop_back();
+        --_size;
+        break;
+      }
+    }
+    if (entries.empty()) {
+      _cells.erase(cell);
+    }
+  }
+
+  void AnchorIndex::insert(std::shared_ptr<NodeAnchor> anchor, ImVec2 center) {
+    NodeAnchor *raw = anchor.get();
+    _cells[cellKey(cellCoordinate(center.x), cellCoordinate(center.y))].push_back(Entry{raw, std::move(anchor)});
+    ++_size;
+  }
+
+  void AnchorIndex::move(std::shared_ptr<NodeAnchor> anchor, ImVec2 from, ImVec2 to) {
+    uint64_t fromKey = cellKey(cellCoordinate(from.x), cellCoordinate(from.y));
+    uint64_t toKey = cellKey(cellCoordinate(to.x), cellCoordinate(to.y));
+    // Most moves stay inside the cell
+    if (fromKey == toKey) {
+      return;
+    }
+    erase(anchor.get(), fromKey);
+    insert(std::move(anchor), to);
+  }
+
+  void AnchorIndex::remove(NodeAnchor *anchor, ImVec2 center) {
+    erase(anchor, cellKey(cellCoordinate(center.x), cellCoordinate(center.y)));
+  }
+
+  void AnchorIndex::markHot(ImVec2 point, float radius, int frame) {
+    FR_PROFILE_SCOPE("AnchorIndex::markHot");
+    int32_t minX = cellCoordinate(point.x - radius);
+    int32_t maxX = cellCoordinate(point.x + radius);
+    int32_t minY = cellCoordinate(point.y - radius);
+    int32_t maxY = cellCoordinate(point.y + radius);
+    float radiusSquared = radius * radius;
+    for (int32_t x = minX; x <= maxX; ++x) {
+      for (int32_t y = minY; y <= maxY; ++y) {
+        auto cell = _cells.find(cellKey(x, y));
+        if (cell == _cells.end()) {
+          continue;
+        }
+        auto &entries = cell->second;
+        size_t i = 0;
+        while (i < entries.size()) {
+          if (entries[i].ref.expired()) {
+            entries[i] = std::move(entries.back());
+            entries.pop_back();
+            --_size;
+            continue;
+          }
+          ImVec2 center = entries[i].anchor->getCenter();
+          float dx = center.x - point.x;
+          float dy = center.y - point.y;
+          if (dx * dx + dy * dy <= radiusSquared) {
+            entries[i].anchor->markHot(frame);
+          }
+          ++i;
+        }
+      }
+    }
+  }
+
+}
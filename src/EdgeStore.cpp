@@ -0,0 +1,136 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/EdgeStore.h>
+#include <fr/Imgui/Canvas.h>
+#include <fr/Imgui/NodeAnchor.h>
+#include <fr/Imgui/Profiler.h>
+#include <algorithm>
+#include <cmath>
+
+namespace fr::Imgui {
+
+  namespace {
+
+    float distance(ImVec2 a, ImVec2 b) {
+      return std::hypot(b.x - a.x, b.y - a.y);
+    }
+
+  }
+
+  std::pair<NodeAnchor *, NodeAnchor *> EdgeStore::orient(NodeAnchor *a, NodeAnchor *b) {
+    if (a->getType() == AnchorType::Down || a->getType() == AnchorType::Right) {
+      return {a, b};
+    }
+    return {b, a};
+  }
+
+  void EdgeStore::add(std::shared_ptr<NodeAnchor> a, std::shared_ptr<NodeAnchor> b) {
+    auto [from, to] = orient(a.get(), b.get());
+    Key key(from, to);
+    if (_index.contains(key)) {
+      return;
+    }
+    _index[key] = _edges.size();
+    Edge edge;
+    edge.from = from;
+    edge.to = to;
+    edge.fromRef = (from == a.get()) ? a : b;
+    edge.toRef = (to == a.get()) ? a : b;
+    edge.color = from->getLinkColor();
+    _edges.push_back(std::move(edge));
+  }
+
+  void EdgeStore::eraseAt(size_t position) {
+    _index.erase(Key(_edges[position].from, _edges[position].to));
+    // Swap the last edge into the hole so removal doesn't shift
+    // the whole vector
+    if (position + 1 != _edges.size()) {
+      _edges[position] = std::move(_edges.back());
+      _index[Key(_edges[position].from, _edges[position].to)] = position;
+    }
+    _edges.pop_back();
+  }
+
+  void EdgeStore::remove(NodeAnchor *a, NodeAnchor *b) {
+    auto [from, to] = orient(a, b);
+    auto found = _index.find(Key(from, to));
+    if (found != _index.end()) {
+      eraseAt(found->second);
+    }
+  }
+
+  bool EdgeStore::contains(NodeAnchor *a, NodeAnchor *b) const {
+    auto [from, to] = orient(a, b);
+    return _index.contains(Key(from, to));
+  }
+
+  void EdgeStore::prune() {
+    size_t position = 0;
+    while (position < _edges.size()) {
+      if (_edges[position].fromRef.expired() || _edges[position].toRef.expired()) {
+        eraseAt(position);
+      } else {
+        ++position;
+      }
+    }
+  }
+
+  void EdgeStore::draw() {
+    FR_PROFILE_SCOPE("EdgeStore::draw");
+    ImDrawList *drawList = ImGui::GetForegroundDrawList();
+    const ImGuiViewport *viewport = ImGui::GetMainViewport();
+    // Pad by the line thickness so edges right on the border still draw
+    float left = viewport->Pos.x - thickness;
+    float top = viewport->Pos.y - thickness;
+    float right = viewport->Pos.x + viewport->Size.x + thickness;
+    float bottom = viewport->Pos.y + viewport->Size.y + thickness;
+    float offset = controlOffset * (_canvas ? _canvas->zoom() : 1.0f);
+
+    int drawn = 0;
+    int culled = 0;
+    bool expired = false;
+    for (const auto &edge : _edges) {
+      if (edge.fromRef.expired() || edge.toRef.expired()) {
+        expired = true;
+        continue;
+      }
+      ImVec2 p1 = edge.from->getCenter();
+      ImVec2 p4 = edge.to->getCenter();
+      ImVec2 p2(p1.x + offset, p1.y);
+      ImVec2 p3(p4.x - offset, p4.y);
+      // A cubic bezier never leaves the box around its control points
+      if (std::max({p1.x, p2.x, p3.x, p4.x}) < left || std::min({p1.x, p2.x, p3.x, p4.x}) > right ||
+          std::max({p1.y, p2.y, p3.y, p4.y}) < top || std::min({p1.y, p2.y, p3.y, p4.y}) > bottom) {
+        ++culled;
+        continue;
+      }
+      // The control polygon is never shorter than the curve, which
+      // is close enough to size the segments by
+      float length = distance(p1, p2) + distance(p2, p3) + distance(p3, p4);
+      int segments = std::clamp(static_cast<int>(length / pixelsPerSegment), minSegments, maxSegments);
+      drawList->AddBezierCubic(p1, p2, p3, p4, edge.color, thickness, segments);
+      ++drawn;
+    }
+    FR_PROFILE_COUNT("Edges drawn", drawn);
+    FR_PROFILE_COUNT("Edges culled", culled);
+
+    if (expired) {
+      prune();
+    }
+  }
+
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/GraphFile.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FR_GRAPH_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace fr::Imgui {
+
+  GraphFormat graphFormatFor(const std::string &path) {
+    auto extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == binaryGraphExtension ? GraphFormat::Binary : GraphFormat::Json;
+  }
+
+#ifdef FR_GRAPH_FILE_MMAP
+  MappedFile::MappedFile(const std::string &path) : _data(nullptr), _size(0), _open(false), _owned(false) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      _error = std::strerror(errno);
+      return;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      _error = std::strerror(errno);
+      ::close(fd);
+      return;
+    }
+    _size = static_cast<size_t>(info.st_size);
+    if (_size > 0) {
+      void *mapped = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped == MAP_FAILED) {
+        _error = std::strerror(errno);
+        _size = 0;
+        ::close(fd);
+        return;
+      }
+      // The archive reads it front to back, once
+      ::madvise(mapped, _size, MADV_SEQUENTIAL);
+      _data = static_cast<const char *>(mapped);
+    }
+    // The mapping keeps the file around on its own
+    ::close(fd);
+    _open = true;
+  }
+
+  MappedFile::~MappedFile() {
+    if (_data && !_owned) {
+      ::munmap(const_cast<char *>(_data), _size);
+    }
+  }
+#else
+  MappedFile::MappedFile(const std::string &path) : _data(nullptr), _size(0), _open(false), _owned(true) {
+    std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!in) {
+      _error = "could not open the file";
+      return;
+    }
+    _size = static_cast<size_t>(in.tellg());
+    in.seekg(0);
+    if (_size > 0) {
+      char *data = new char[_size];
+      if (!in.read(data, _size)) {
+        delete[] data;
+        _size = 0;
+        _error = "could not read the file";
+        return;
+      }
+      _data = data;
+    }
+    _open = true;
+  }
+
+  MappedFile::~MappedFile() {
+    delete[] _data;
+  }
+#endif
+
+  MappedGraphStreambuf::MappedGraphStreambuf(const std::string &path, GraphLoad *load) :
+    _file(path),
+    _load(load),
+    _offset(0) {
+  }
+
+  MappedGraphStreambuf::int_type MappedGraphStreambuf::underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    if ((_load && _load->cancelled()) || _offset >= _file.size()) {
+      return traits_type::eof();
+    }
+    size_t count = std::min(chunkSize, _file.size() - _offset);
+    // Nothing writes through the get area (pbackfail isn't
+    // overridden), so handing out the read only pages is fine
+    char *begin = const_cast<char *>(_file.data()) + _offset;
+    setg(begin, begin, begin + count);
+    _offset += count;
+    if (_load) {
+      _load->addBytesRead(count);
+    }
+    return traits_type::to_int_type(*gptr());
+  }
+
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/IniSettings.h>
+#include <fr/Imgui/Log.h>
+#include <fstream>
+#include <imgui.h>
+#include <sstream>
+#include <vector>
+
+namespace fr::Imgui {
+
+  namespace {
+
+    constexpr std::string_view windowHeader = "[Window][";
+
+    // One "[Type][Name]" header and the lines up to the next one
+    struct Section {
+      std::string_view text;
+      // Window name for [Window] sections, empty for anything else
+      std::string_view window;
+    };
+
+    std::vector<Section> split(std::string_view ini) {
+      std::vector<Section> sections;
+      size_t start = 0;
+      while (start < ini.size()) {
+        // Sections start at a '[' at the beginning of a line
+        size_t next = ini.find("\n[", start);
+        size_t end = next == std::string_view::npos ? ini.size() : next + 1;
+        Section section{ini.substr(start, end - start), {}};
+        if (section.text.starts_with(windowHeader)) {
+          size_t lineEnd = section.text.find('\n');
+          std::string_view header = section.text.substr(0, lineEnd);
+          size_t close = header.rfind(']');
+          if (close != std::string_view::npos && close >= windowHeader.size()) {
+            section.window = header.substr(windowHeader.size(), close - windowHeader.size());
+          }
+        }
+        sections.push_back(section);
+        start = end;
+      }
+      return sections;
+    }
+
+  }
+
+  IniSettings::IniSettings() : _maxWindows(defaultMaxWindows) {
+  }
+
+  IniSettings &IniSettings::instance() {
+    static IniSettings settings;
+    return settings;
+  }
+
+  std::string_view IniSettings::identity(std::string_view name) {
+    size_t found = name.find("###");
+    if (found != std::string_view::npos) {
+      return name.substr(found);
+    }
+    return name;
+  }
+
+  bool IniSettings::claim(const std::string &identity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_live.insert(identity).second) {
+      return false;
+    }
+    _seen.insert(identity);
+    return true;
+  }
+
+  void IniSettings::release(const std::string &identity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _live.erase(identity);
+  }
+
+  void IniSettings::touch(std::string_view name) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _seen.emplace(identity(name));
+  }
+
+  void IniSettings::setMaxWindows(size_t maxWindows) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxWindows = maxWindows;
+  }
+
+  std::string IniSettings::prune(std::string_view ini) {
+    std::vector<Section> sections = split(ini);
+    std::vector<std::string_view> stale;
+    std::vector<std::string_view> used;
+    std::vector<std::string_view> other;
+    size_t maxWindows = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      maxWindows = _maxWindows;
+      for (const Section &section : sections) {
+        if (section.window.empty()) {
+          other.push_back(section.text);
+        } else if (_seen.contains(std::string(identity(section.window)))) {
+          used.push_back(section.text);
+        } else {
+          stale.push_back(section.text);
+        }
+      }
+    }
+
+    // Stale entries are in the order the last save left them, which
+    // puts the ones used longest ago first
+    size_t keep = maxWindows > used.size() ? maxWindows - used.size() : 0;
+    size_t drop = stale.size() > keep ? stale.size() - keep : 0;
+    if (drop > 0) {
+      FR_LOG_INFO(General, "Pruned {} stale window entries from ini settings", drop);
+    }
+
+    std::string pruned;
+    pruned.reserve(ini.size());
+    for (size_t i = drop; i < stale.size(); ++i) {
+      pruned.append(stale[i]);
+    }
+    for (std::string_view text : used) {
+      pruned.append(text);
+    }
+    for (std::string_view text : other) {
+      pruned.append(text);
+    }
+    return pruned;
+  }
+
+  void IniSettings::load(const char *path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+      return;
+    }
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string pruned = prune(contents.str());
+    ImGui::LoadIniSettingsFromMemory(pruned.data(), pruned.size());
+  }
+
+  void IniSettings::save(const char *path) {
+    size_t size = 0;
+    const char *ini = ImGui::SaveIniSettingsToMemory(&size);
+    std::string pruned = prune(std::string_view(ini, size));
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      FR_LOG_WARN(General, "Could not write ini settings to {}", path);
+      return;
+    }
+    out.write(pruned.data(), pruned.size());
+  }
+
+}
@@ -0,0 +1,154 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/Log.h>
+#include <iostream>
+#include <string_view>
+
+namespace fr::Imgui {
+
+  Logger::Logger() : _slots(std::make_unique<std::array<Slot, capacity>>()),
+                     _enqueue(0),
+                     _dequeue(0),
+                     _sleeping(false),
+                     _level(FR_LOG_LEVEL),
+                     _categories(~0u),
+                     _dropped(0),
+                     _running(true),
+                     _epoch(Clock::now()) {
+    static_assert((capacity & (capacity - 1)) == 0, "Logger capacity has to be a power of two");
+    for (size_t i = 0; i < capacity; ++i) {
+      (*_slots)[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    _drainThread = std::thread([this]() { drainLoop(); });
+  }
+
+  Logger::~Logger() {
+    _running.store(false);
+    _sleeping.store(false);
+    _sleeping.notify_one();
+    if (_drainThread.joinable()) {
+      _drainThread.join();
+    }
+  }
+
+  Logger &Logger::instance() {
+    static Logger logger;
+    return logger;
+  }
+
+  const char *Logger::levelName(LogLevel level) {
+    switch (level) {
+    case LogLevel::Trace: return "TRACE";
+    case LogLevel::Debug: return "DEBUG";
+    case LogLevel::Info: return "INFO";
+    case LogLevel::Warn: return "WARN";
+    case LogLevel::Error: return "ERROR";
+    default: return "";
+    }
+  }
+
+  const char *Logger::categoryName(LogCategory category) {
+    switch (category) {
+    case LogCategory::General: return "general";
+    case LogCategory::Anchor: return "anchor";
+    case LogCategory::Factory: return "factory";
+    case LogCategory::Rest: return "rest";
+    case LogCategory::Db: return "db";
+    default: return "";
+    }
+  }
+
+  Logger::Slot *Logger::claim(size_t &position) {
+    position = _enqueue.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot &slot = (*_slots)[position & (capacity - 1)];
+      size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          return &slot;
+        }
+      } else if (difference < 0) {
+        // The drain thread hasn't caught up with this lap yet
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+      } else {
+        position = _enqueue.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void Logger::publish(Slot *slot, size_t position) {
+    slot->sequence.store(position + 1, std::memory_order_release);
+    // Pairs with the fence in drainLoop. Either the drain thread sees
+    // this slot before it sleeps or we see it sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_relaxed) && _sleeping.exchange(false)) {
+      _sleeping.notify_one();
+    }
+  }
+
+  bool Logger::ready() const {
+    const Slot &slot = (*_slots)[_dequeue & (capacity - 1)];
+    return slot.sequence.load(std::memory_order_acquire) == _dequeue + 1;
+  }
+
+  size_t Logger::drain() {
+    size_t written = 0;
+    for (;;) {
+      Slot &slot = (*_slots)[_dequeue & (capacity - 1)];
+      if (slot.sequence.load(std::memory_order_acquire) != _dequeue + 1) {
+        break;
+      }
+      std::cout << std::format("[{:>10.3f}] {:<5} {}: ", slot.nanos / 1.0e6,
+                               levelName(slot.level), categoryName(slot.category))
+                << std::string_view(slot.text, slot.length) << '\n';
+      // Hand the slot back for the next lap around the ring
+      slot.sequence.store(_dequeue + capacity, std::memory_order_release);
+      ++_dequeue;
+      ++written;
+    }
+    if (written) {
+      std::cout.flush();
+    }
+    return written;
+  }
+
+  void Logger::drainLoop() {
+    uint64_t reportedDrops = 0;
+    while (_running.load()) {
+      if (drain() == 0) {
+        // Nothing to write, so sleep until a publish wakes us rather
+        // than polling an idle editor
+        _sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ready() && _running.load()) {
+          _sleeping.wait(true);
+        }
+        _sleeping.store(false, std::memory_order_relaxed);
+      }
+      uint64_t drops = dropped();
+      if (drops != reportedDrops) {
+        std::cout << std::format("Logger dropped {} messages", drops - reportedDrops) << std::endl;
+        reportedDrops = drops;
+      }
+    }
+    // Whatever made it in before shutdown
+    drain();
+  }
+
+}
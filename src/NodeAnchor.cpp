@@ -15,7 +15,8 @@
  */
 
 #include <fr/Imgui/NodeAnchor.h>
-#include <iostream>
+#include <fr/Imgui/Log.h>
+#include <fr/Imgui/Profiler.h>
 
 namespace fr::Imgui {
 
@@ -28,12 +29,54 @@ namespace fr::Imgui {
 
   void NodeAnchor::setLinkColor(ImU32 color) { _linkColor = color; }
 
+  EdgeStore *NodeAnchor::edgeStore() {
+    Window *parent = parentWindow();
+    return parent ? parent->getEdgeStore() : nullptr;
+  }
+
+  AnchorIndex *NodeAnchor::anchorIndex() {
+    Window *parent = parentWindow();
+    return parent ? parent->getAnchorIndex() : nullptr;
+  }
+
+  NodeHandles *NodeAnchor::nodeHandles() {
+    Window *parent = parentWindow();
+    return parent ? parent->getNodeHandles() : nullptr;
+  }
+
+  float NodeAnchor::controlOffset() {
+    Window *parent = parentWindow();
+    Canvas *canvas = parent ? parent->getCanvas() : nullptr;
+    return EdgeStore::controlOffset * (canvas ? canvas->zoom() : 1.0f);
+  }
+
+  bool NodeAnchor::frozen() {
+    auto p = dynamic_cast<NodeWindow *>(parentWindow());
+    return p && p->frozen();
+  }
+
+  NodeHandle NodeAnchor::nodeHandle() {
+    if (_handle != invalidNodeHandle) {
+      return _handle;
+    }
+    if (!_node) {
+      if (auto p = dynamic_cast<NodeWindow *>(parentWindow())) {
+        _node = p->getNode();
+      }
+    }
+    if (auto handles = nodeHandles()) {
+      _handle = handles->intern(_node);
+    }
+    // Still invalidNodeHandle if the window isn't in an editor yet
+    return _handle;
+  }
+
   void NodeAnchor::establishConnection(std::shared_ptr<NodeDragPayload> connection,
                                        bool modifyNode) {
     // Check _connections and don't do anything at this point if the
     // node ID is already in the connections (This keeps us from getting
     // into an infinite loop of establishing connections)
-    std::cout << "Examining " << connection->sourceNode->idString() << std::endl;
+    FR_LOG_TRACE(Anchor, "Examining {}", connection->sourceNode->idString());
     // Reject connection if the far node is the wrong type
     if ((_type == AnchorType::Up && connection->anchorType != AnchorType::Down) ||
         (_type == AnchorType::Down && connection->anchorType != AnchorType::Up) ||
@@ -41,12 +84,22 @@ namespace fr::Imgui {
          connection->anchorType != AnchorType::Right) ||
         (_type == AnchorType::Right &&
          connection->anchorType != AnchorType::Left)) {
-      std::cout << "Reject connection: wrong anchor type" << std::endl;
+      FR_LOG_DEBUG(Anchor, "Reject connection: wrong anchor type");
       return;
     }
-    if (!_connections.contains(connection->sourceNode->idString())) {
-      auto otherSide = std::make_shared<NodeDragPayload>();
-      _connections[connection->sourceNode->idString()] = connection;
+    NodeHandle source = connection->dragSource->nodeHandle();
+    if (source == invalidNodeHandle || nodeHandle() == invalidNodeHandle) {
+      // Connections are keyed on handles, so there's nothing to key
+      // this one on until both windows are in an editor
+      FR_LOG_DEBUG(Anchor, "Reject connection: anchor has no node handle");
+      return;
+    }
+    if (!_connections.contains(source)) {
+      auto otherSide = makeArenaShared<NodeDragPayload>();
+      _connections[source] = connection;
+      if (auto edges = edgeStore()) {
+        edges->add(shared_from_this(), connection->dragSource);
+      }
       otherSide->dragSource = shared_from_this();
       otherSide->sourceNode = _node;
       otherSide->anchorType = _type;
@@ -73,9 +126,13 @@ namespace fr::Imgui {
   void NodeAnchor::removeConnection(std::shared_ptr<NodeDragPayload> connection) {
     // If connections contain the node then remove it, otherwise
     // do nothing
-    if (_connections.contains(connection->sourceNode->idString())) {
-      auto otherSide = std::make_shared<NodeDragPayload>();
-      _connections.erase(connection->sourceNode->idString());
+    NodeHandle source = connection->dragSource->nodeHandle();
+    if (_connections.contains(source)) {
+      auto otherSide = makeArenaShared<NodeDragPayload>();
+      _connections.erase(source);
+      if (auto edges = edgeStore()) {
+        edges->remove(this, connection->dragSource.get());
+      }
       otherSide->dragSource = shared_from_this();
       otherSide->sourceNode = _node;
       otherSide->anchorType = _type;
@@ -88,20 +145,46 @@ namespace fr::Imgui {
     }
   }
 
+  void NodeAnchor::disconnectAll() {
+    NodeHandle self = nodeHandle();
+    EdgeStore *edges = edgeStore();
+    for (const auto &[handle, connection] : _connections) {
+      NodeAnchor *other = connection->dragSource.get();
+      if (edges) {
+        edges->remove(this, other);
+      }
+      // The other end is keyed on our node
+      other->_connections.erase(self);
+    }
+    _connections.clear();
+    if (_indexed) {
+      if (auto index = anchorIndex()) {
+        index->remove(this, _center);
+      }
+      _indexed = false;
+    }
+  }
+
   void NodeAnchor::drawConnections() {
-    for (auto [id, connection] : _connections) {
-      ImDrawList *drawList = ImGui::GetForegroundDrawList();
+    if (edgeStore()) {
+      return;
+    }
+    FR_PROFILE_TOTAL("NodeAnchor::drawConnections");
+    ImDrawList *drawList = ImGui::GetForegroundDrawList();
+    float offset = controlOffset();
+    for (const auto &[id, connection] : _connections) {
       ImVec2 p1 = _center;
       ImVec2 p4 = connection->dragSource->getCenter();
-      ImVec2 p2 = ImVec2(p1.x + 50.0f, p1.y);
-      ImVec2 p3 = ImVec2(p4.x - 50.0f, p4.y);
+      ImVec2 p2 = ImVec2(p1.x + offset, p1.y);
+      ImVec2 p3 = ImVec2(p4.x - offset, p4.y);
       drawList->AddBezierCubic(p1, p2, p3, p4, _linkColor, 2, 4);
     }
   }
 
   void NodeAnchor::begin() {
+    FR_PROFILE_TOTAL("NodeAnchor::begin");
     if (!_node) {
-      if (auto p = std::dynamic_pointer_cast<NodeWindow>(_parent)) {
+      if (auto p = dynamic_cast<NodeWindow *>(parentWindow())) {
         _node = p->getNode();
       }
     }
@@ -110,6 +193,14 @@ namespace fr::Imgui {
 
     // Color to render this time around
     ImU32 color;
+    // Unless the mouse is near or we're the drag source there's
+    // nothing to hover, drag or drop on, so skip the ImGui items.
+    // Without an index every anchor has to check for itself.
+    if (!_dragging && _hotFrame != ImGui::GetFrameCount() && anchorIndex()) {
+      _hovered = false;
+      ImGui::GetWindowDrawList()->AddCircleFilled(_center, _radius, _color);
+      return;
+    }
     // Set an invisible button to detect hover state
     ImGui::SetCursorScreenPos(_min);
     ImGui::InvisibleButton(_label.c_str(), _bbsize);
@@ -125,7 +216,7 @@ namespace fr::Imgui {
     // Handle drags
     if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_SourceAllowNullID)) {
       if (!_currentDrag || !_dragging) {
-        std::cout << "BeginDropSource: " << _node->idString() << std::endl;
+        FR_LOG_DEBUG(Anchor, "BeginDropSource: {}", _node->idString());
         _currentDrag = std::make_shared<NodeDragPayload>();
         _currentDrag->dragSource = shared_from_this();
         _currentDrag->sourceNode = _node;
@@ -146,27 +237,34 @@ namespace fr::Imgui {
       ImDrawList *drawList = ImGui::GetForegroundDrawList();
       ImVec2 p1 = _center;
       ImVec2 p4 = cursor;
-      ImVec2 p2 = ImVec2(p1.x + 50.0f, p1.y);
-      ImVec2 p3 = ImVec2(p4.x - 50.0f, p4.y);
+      float offset = controlOffset();
+      ImVec2 p2 = ImVec2(p1.x + offset, p1.y);
+      ImVec2 p3 = ImVec2(p4.x - offset, p4.y);
       drawList->AddBezierCubic(p1, p2, p3, p4, _linkColor, 2, 4);
     } else if (_dragging && !ImGui::IsMouseDown(ImGuiMouseButton_Left)) {
-      std::cout << "Dragging stopped" << std::endl;
+      FR_LOG_DEBUG(Anchor, "Dragging stopped");
       _dragging = false;
     }
 
     // Handle Drops
     if (ImGui::BeginDragDropTarget()) {
-      std::cout << "BeginDragDropTarget to: " << _node->idString() << std::endl;
+      FR_LOG_TRACE(Anchor, "BeginDragDropTarget to: {}", _node->idString());
       if (const ImGuiPayload *payload =
           ImGui::AcceptDragDropPayload("NodeLinkPayload")) {
         std::shared_ptr<NodeDragPayload> connection;
         connection.swap(_currentDrag);
 
-        std::cout << "Accepted payload from: "
-                  << connection->sourceNode->idString() << std::endl;
+        FR_LOG_DEBUG(Anchor, "Accepted payload from: {}", connection->sourceNode->idString());
         // If we already have a link to the payload, remove the connection instead
-        // of creating it.
-        if (!_connections.contains(connection->sourceNode->idString())) {
+        // of creating it. Either end being frozen means something's
+        // reading its node, so leave the links alone.
+        if (frozen() || connection->dragSource->frozen()) {
+          FR_LOG_INFO(Anchor, "Not linking {} while it's being saved", _node->idString());
+        } else if (!nodeHandles() || nodeHandles() != connection->dragSource->nodeHandles()) {
+          // Handles from different tables (or none) could collide
+          FR_LOG_INFO(Anchor, "Not linking {}, both windows have to be in the same editor",
+                      _node->idString());
+        } else if (!_connections.contains(connection->dragSource->nodeHandle())) {
           establishConnection(connection);
         } else {
           removeConnection(connection);
@@ -183,11 +281,22 @@ namespace fr::Imgui {
   void NodeAnchor::end() {}
 
   void NodeAnchor::setCenter(ImVec2 center) {
+    ImVec2 previous = _center;
     _center = center;
     _min.x = center.x - _radius;
     _min.y = center.y - _radius;
     _bbsize.x = _radius * 2;
     _bbsize.y = _radius * 2;
+    // Windows call this every frame they render, the index only
+    // needs to hear about it when the anchor actually moved
+    if (auto index = anchorIndex()) {
+      if (!_indexed) {
+        index->insert(shared_from_this(), center);
+        _indexed = true;
+      } else if (previous.x != center.x || previous.y != center.y) {
+        index->move(shared_from_this(), previous, center);
+      }
+    }
   }
 
 } // namespace fr::Imgui
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/NodeHandles.h>
+#include <fr/Imgui/Window.h>
+#include <fr/RequirementsManager/Node.h>
+
+namespace fr::Imgui {
+
+  NodeHandles::NodeHandles() : _slots(1) {
+  }
+
+  NodeHandle NodeHandles::intern(const NodePtr &node) {
+    if (!node) {
+      return invalidNodeHandle;
+    }
+    auto address = _byAddress.find(node.get());
+    if (address != _byAddress.end()) {
+      if (!address->second.node.expired()) {
+        return address->second.handle;
+      }
+      // Somebody else's old address
+      _byAddress.erase(address);
+    }
+
+    std::string uuid = node->idString();
+    NodeHandle handle;
+    auto found = _byUuid.find(uuid);
+    if (found != _byUuid.end()) {
+      // Same node, different object (loaded again, say)
+      handle = found->second;
+    } else {
+      if (!_free.empty()) {
+        handle = _free.back();
+        _free.pop_back();
+      } else {
+        handle = static_cast<NodeHandle>(_slots.size());
+        _slots.emplace_back();
+      }
+      _byUuid.emplace(uuid, handle);
+      _slots[handle].uuid = std::move(uuid);
+    }
+    _slots[handle].addresses.push_back(node.get());
+    _byAddress.emplace(node.get(), Address{node, handle});
+    return handle;
+  }
+
+  NodeHandle NodeHandles::find(const NodePtr &node) const {
+    if (!node) {
+      return invalidNodeHandle;
+    }
+    auto address = _byAddress.find(node.get());
+    if (address == _byAddress.end() || address->second.node.expired()) {
+      return invalidNodeHandle;
+    }
+    return address->second.handle;
+  }
+
+  void NodeHandles::setWindow(NodeHandle handle, std::shared_ptr<Window> window) {
+    if (handle != invalidNodeHandle && handle < _slots.size()) {
+      _slots[handle].window = window;
+    }
+  }
+
+  void NodeHandles::release(NodeHandle handle) {
+    if (handle == invalidNodeHandle || handle >= _slots.size()) {
+      return;
+    }
+    Slot &slot = _slots[handle];
+    if (slot.uuid.empty()) {
+      // Already released
+      return;
+    }
+    // All of them, or a node loaded twice would keep pointing at the
+    // handle once somebody else has it
+    for (const fr::RequirementsManager::Node *interned : slot.addresses) {
+      auto address = _byAddress.find(interned);
+      if (address != _byAddress.end() && address->second.handle == handle) {
+        _byAddress.erase(address);
+      }
+    }
+    _byUuid.erase(slot.uuid);
+    // Give the memory back too, this could be a big graph closing
+    slot = Slot();
+    _free.push_back(handle);
+  }
+
+  std::shared_ptr<Window> NodeHandles::window(NodeHandle handle) const {
+    if (handle >= _slots.size()) {
+      return nullptr;
+    }
+    return _slots[handle].window.lock();
+  }
+
+  const std::string &NodeHandles::uuid(NodeHandle handle) const {
+    if (handle >= _slots.size()) {
+      return _slots[invalidNodeHandle].uuid;
+    }
+    return _slots[handle].uuid;
+  }
+
+}
@@ -15,6 +15,9 @@
  */
 
 #include <fr/Imgui/NodeWindow.h>
+#include <algorithm>
+#include <functional>
+#include <string_view>
 
 namespace fr::Imgui {
 
@@ -24,25 +27,59 @@ bool NodeWindow::_defaultDisplayEditabilityCheckbox = true;
 NodeWindow::NodeWindow(const std::string &label)
     : Parent(label), _editable(_defaultEditable),
       _displayEditable(_defaultDisplayEditabilityCheckbox),
-      _displayDebugButton(false), _initted(false) {
+      _displayDebugButton(false), _initted(false), _canvasPos(0, 0),
+      _canvasWindowSize(0, 0), _canvasContentSize(0, 0), _placed(false),
+      _canvasVersion(0), _reposition(false), _detail(DetailLevel::Full),
+      _frozen(0), _editableBeforeFreeze(false),
+      _displayEditableBeforeFreeze(false) {
   memset(_idText, '\0', idTextLen);
+  _titleLength = std::min(_label.find("##"), _label.size());
+  std::string_view title(_label.data(), _titleLength);
+  float hue = static_cast<float>(std::hash<std::string_view>{}(title) % 360) / 360.0f;
+  _boxColor = ImColor::HSV(hue, 0.5f, 0.6f);
   ImU32 white = IM_COL32(255, 255, 255, 255);
   ImU32 red = IM_COL32(255, 0, 0, 255);
-  _upAnchor = std::make_shared<NodeAnchor>("##UpAnchor", ImVec2(0, 0), 5.0,
+  // In the graph's arena when WindowFactory is creating us
+  _upAnchor = makeArenaShared<NodeAnchor>("##UpAnchor", ImVec2(0, 0), 5.0,
                                            white, red, AnchorType::Up);
-  _downAnchor = std::make_shared<NodeAnchor>("##DownAnchor", ImVec2(0, 0), 5.0,
+  _downAnchor = makeArenaShared<NodeAnchor>("##DownAnchor", ImVec2(0, 0), 5.0,
                                              white, red, AnchorType::Down);
-  _enableEditingLabel = getUniqueLabel("Enable Editing");
-  _nodeIdLabel = getUniqueLabel("##ID:");
-  _debugButtonLabel = getUniqueLabel("DEBUG!");
+  _enableEditingLabel = "Enable Editing";
+  _nodeIdLabel = "##ID:";
+  _debugButtonLabel = "DEBUG!";
+}
+
+NodeWindow::~NodeWindow() {
+  if (!_identity.empty()) {
+    IniSettings::instance().release(_identity);
+  }
 }
 
 void NodeWindow::addNode(fr::RequirementsManager::Node::PtrType node) {
   _node = node;
+  if (_initted) {
+    claimIdentity();
+  }
 }
 
 fr::RequirementsManager::Node::PtrType NodeWindow::getNode() { return _node; }
 
+void NodeWindow::freeze() {
+  if (_frozen++ == 0) {
+    _editableBeforeFreeze = _editable;
+    _displayEditableBeforeFreeze = _displayEditable;
+    _editable = false;
+    _displayEditable = false;
+  }
+}
+
+void NodeWindow::thaw() {
+  if (_frozen > 0 && --_frozen == 0) {
+    _editable = _editableBeforeFreeze;
+    _displayEditable = _displayEditableBeforeFreeze;
+  }
+}
+
 void NodeWindow::setDisplayDebugButton(bool d) { _displayDebugButton = d; }
 
 void NodeWindow::init() {
@@ -55,23 +92,55 @@ void NodeWindow::init() {
   auto sub =
       this->moved.connect([&](Window::PtrType parent, const ImVec2 &pos) {
         _min = pos;
-        // This always places the upListcenter anchor
-        // 25 pixels below the titlebar
-        ImVec2 upListCenter(_currentSize.x / 2.0, 25.0);
-        _upAnchor->setCenter(screenCoordinate(upListCenter));
-        // There seems to be some slop on the bottom, so
-        // _currentSize is more than adequate as an offset from
-        // there (I should check and see if I can make it a positive
-        // number and exceed the bound down into the slop.
-        ImVec2 downListCenter(_currentSize.x / 2.0, _currentSize.y);
-        _downAnchor->setCenter(screenCoordinate(downListCenter));
+        positionAnchors(_currentSize);
       });
 
   _subscriptions.push_back(std::move(sub));
 
+  // moved only fires when the window does move now, so a window that
+  // grows or shrinks in place needs its anchors put back at the edges
+  auto resizeSub =
+      this->resized.connect([&](Window::PtrType parent, const ImVec2 &size) {
+        positionAnchors(size);
+      });
+
+  _subscriptions.push_back(std::move(resizeSub));
+
+  claimIdentity();
   _initted = true;
 }
 
+void NodeWindow::close() {
+  _upAnchor->disconnectAll();
+  _downAnchor->disconnectAll();
+  for (auto &subscription : _subscriptions) {
+    subscription.disconnect();
+  }
+  _subscriptions.clear();
+}
+
+void NodeWindow::claimIdentity() {
+  if (!_node) {
+    return;
+  }
+  std::string identity = std::format("###{}", _node->idString());
+  if (identity == _identity) {
+    return;
+  }
+  std::string title = _label.substr(0, _titleLength);
+  if (!_identity.empty()) {
+    // Node changed after init. Don't leave the old node's UUID in
+    // the name.
+    IniSettings::instance().release(_identity);
+    _identity.clear();
+    _label = getUniqueLabel(title);
+  }
+  if (IniSettings::instance().claim(identity)) {
+    _identity = std::move(identity);
+    _label = title + _identity;
+  }
+}
+
 std::string NodeWindow::idString() {
   std::string ret;
   if (_node) {
@@ -80,6 +149,156 @@ std::string NodeWindow::idString() {
   return ret;
 }
 
+bool NodeWindow::onScreen() {
+  if (!_started || !cullable()) {
+    return true;
+  }
+  const ImGuiViewport *viewport = ImGui::GetMainViewport();
+  float left = viewport->Pos.x;
+  float top = viewport->Pos.y;
+  float right = left + viewport->Size.x;
+  float bottom = top + viewport->Size.y;
+  return _min.x < right && _min.y < bottom &&
+         _min.x + _windowSize.x > left && _min.y + _windowSize.y > top;
+}
+
+void NodeWindow::drawConnections() {
+  _upAnchor->drawConnections();
+  _downAnchor->drawConnections();
+}
+
+void NodeWindow::positionAnchors(ImVec2 contentSize) {
+  // This always places the upListcenter anchor
+  // 25 pixels below the titlebar
+  ImVec2 upListCenter(contentSize.x / 2.0, 25.0);
+  _upAnchor->setCenter(screenCoordinate(upListCenter));
+  // There seems to be some slop on the bottom, so
+  // _currentSize is more than adequate as an offset from
+  // there (I should check and see if I can make it a positive
+  // number and exceed the bound down into the slop.
+  ImVec2 downListCenter(contentSize.x / 2.0, contentSize.y);
+  _downAnchor->setCenter(screenCoordinate(downListCenter));
+}
+
+void NodeWindow::followCanvas() {
+  if (_canvasVersion == _canvas->version()) {
+    return;
+  }
+  _canvasVersion = _canvas->version();
+  _min = _canvas->toScreen(_canvasPos);
+  _windowSize = _canvas->scale(_canvasWindowSize);
+  // Windows that don't render this frame still need their anchors
+  // moved so edges to them land in the right place
+  positionAnchors(_canvas->scale(_canvasContentSize));
+  _reposition = true;
+}
+
+void NodeWindow::updateCanvasPosition() {
+  if (!_canvas) {
+    return;
+  }
+  // ImGui nudges windows that hang off the edge of the screen back
+  // on, so once the window is placed only believe its position
+  // while the user is actually dragging it around
+  if (_placed && !(ImGui::IsWindowFocused() && ImGui::IsMouseDown(ImGuiMouseButton_Left))) {
+    return;
+  }
+  _canvasPos = _canvas->toCanvas(_min);
+  _canvasWindowSize = _canvas->unscale(_windowSize);
+  _canvasContentSize = _canvas->unscale(_currentSize);
+  _canvasVersion = _canvas->version();
+  _placed = true;
+}
+
+void NodeWindow::drawBox() {
+  ImDrawList *drawList = ImGui::GetWindowDrawList();
+  ImVec2 max(_min.x + _windowSize.x, _min.y + _windowSize.y);
+  ImVec2 titleMax(max.x, std::min(max.y, _min.y + ImGui::GetFrameHeight()));
+  drawList->AddRectFilled(_min, max, ImGui::ColorConvertFloat4ToU32(_backgroundColor));
+  drawList->AddRectFilled(_min, titleMax, _boxColor);
+  drawList->AddRect(_min, max, ImGui::GetColorU32(ImGuiCol_Border));
+  ImVec4 clip(_min.x, _min.y, max.x, max.y);
+  drawList->AddText(nullptr, 0.0f, ImVec2(_min.x + 2.0f, _min.y),
+                    ImGui::GetColorU32(ImGuiCol_Text), _label.c_str(),
+                    _label.c_str() + _titleLength, 0.0f, &clip);
+}
+
+void NodeWindow::renderSummary() {
+  FR_PROFILE_TOTAL("NodeWindow::renderSummary");
+  // Window::begin rather than begin, so none of the editable widgets
+  // get submitted. The anchors still render so edges can be edited.
+  Window::begin();
+  updateCanvasPosition();
+  drawSummary();
+  end();
+}
+
+void NodeWindow::drawSummary() {
+  ImGui::TextUnformatted(_idText);
+  if (!_summary.empty()) {
+    ImGui::TextWrapped("%s", _summary.c_str());
+  }
+}
+
+std::string NodeWindow::summarize(const std::string &text) {
+  if (text.size() <= summaryLen) {
+    return text;
+  }
+  // Don't cut a UTF-8 sequence in half
+  size_t len = summaryLen;
+  while (len > 0 && (static_cast<unsigned char>(text[len]) & 0xC0) == 0x80) {
+    --len;
+  }
+  return text.substr(0, len) + "...";
+}
+
+void NodeWindow::render() {
+  DetailLevel detail = DetailLevel::Full;
+  if (_canvas && _placed) {
+    followCanvas();
+    if (cullable()) {
+      detail = _canvas->detailLevel();
+    }
+  }
+
+  if (!onScreen()) {
+    FR_PROFILE_COUNT("Node windows culled", 1);
+    drawConnections();
+    return;
+  }
+
+  // The summary only needs building when the window drops down to
+  // it. Nothing can be edited until it comes back up to Full.
+  if (detail == DetailLevel::Summary && _detail != DetailLevel::Summary) {
+    _summary = summary();
+  }
+  _detail = detail;
+
+  if (detail == DetailLevel::Box) {
+    FR_PROFILE_COUNT("Node windows drawn as boxes", 1);
+    drawBox();
+    drawConnections();
+    return;
+  }
+
+  if (_reposition) {
+    ImGui::SetNextWindowPos(_min);
+    ImGui::SetNextWindowSize(_windowSize);
+    _reposition = false;
+  }
+  if (_canvas) {
+    ImGui::PushFont(nullptr, ImGui::GetStyle().FontSizeBase * _canvas->zoom());
+  }
+  if (detail == DetailLevel::Summary) {
+    renderSummary();
+  } else {
+    Parent::render();
+  }
+  if (_canvas) {
+    ImGui::PopFont();
+  }
+}
+
 void NodeWindow::beginning() {
   if (!_node || !_initted) {
     init();
@@ -92,19 +311,20 @@ void NodeWindow::beginning() {
 
 void NodeWindow::begin() {
   Parent::begin();
+  updateCanvasPosition();
 
   if (_displayDebugButton) {
-    if (ImGui::Button(_debugButtonLabel.c_str())) {
+    if (ImGui::Button(_debugButtonLabel)) {
       std::cout << std::endl << _node->to_json() << std::endl;
     }
   }
 
   if (_displayEditable) {
-    ImGui::Checkbox(_enableEditingLabel.c_str(), &_editable);
+    ImGui::Checkbox(_enableEditingLabel, &_editable);
   }
   ImGui::Text("Node ID: ");
   ImGui::SameLine();
-  ImGui::InputText(_nodeIdLabel.c_str(), _idText, idTextLen - 1,
+  ImGui::InputText(_nodeIdLabel, _idText, idTextLen - 1,
                    ImGuiInputTextFlags_ReadOnly);
 }
 
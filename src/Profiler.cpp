@@ -0,0 +1,253 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/Profiler.h>
+#include <algorithm>
+#include <cstring>
+#include <format>
+
+namespace fr::Imgui {
+
+  thread_local uint32_t ProfileScope::_depth = 0;
+
+  namespace {
+
+    // Small sequential thread IDs read a lot better in the trace
+    // viewer than hashed std::thread::ids
+    uint32_t currentThread() {
+      static std::atomic<uint32_t> nextThread{1};
+      thread_local uint32_t thread = nextThread.fetch_add(1);
+      return thread;
+    }
+
+    // Scope names are literals from our own code, but escape them
+    // anyway so a stray quote can't break the JSON
+    void writeEscaped(std::ostream &out, const char *text) {
+      for (const char *c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+          out << '\\';
+        }
+        out << *c;
+      }
+    }
+
+    double micros(uint64_t nanos) {
+      return nanos / 1000.0;
+    }
+
+    // FR_PROFILE_TOTAL scopes on this thread since it last flushed.
+    // Only a handful of names use it, so a linear search is fine.
+    struct ThreadTotals : std::vector<ProfileTotal> {
+      // A thread that only ever added totals still gets them in
+      ~ThreadTotals() {
+        if (!empty()) {
+          Profiler::instance().flushTotals();
+        }
+      }
+    };
+
+    thread_local ThreadTotals threadTotals;
+
+    ProfileTotal *findTotal(std::vector<ProfileTotal> &totals, const char *name) {
+      for (auto &total : totals) {
+        if (total.name == name || strcmp(total.name, name) == 0) {
+          return &total;
+        }
+      }
+      return nullptr;
+    }
+
+    // Moves this thread's totals into totals. Call with the lock held.
+    void mergeTotals(std::vector<ProfileTotal> &totals) {
+      for (const auto &pending : threadTotals) {
+        if (ProfileTotal *total = findTotal(totals, pending.name)) {
+          total->calls += pending.calls;
+          total->duration += pending.duration;
+          total->max = std::max(total->max, pending.max);
+        } else {
+          totals.push_back(pending);
+        }
+      }
+      threadTotals.clear();
+    }
+
+  }
+
+  Profiler::Profiler() : _enabled(false),
+                         _epoch(Clock::now()),
+                         _current(0),
+                         _completed(0),
+                         _frameNumber(0) {
+  }
+
+  Profiler &Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+  }
+
+  void Profiler::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  void Profiler::beginFrame() {
+    if (!enabled()) {
+      return;
+    }
+    // Samples recorded between frames (a graph loading on another
+    // thread, say) are kept and show up in this frame
+    std::lock_guard<std::mutex> lock(_mutex);
+    ProfileFrame &frame = _frames[_current];
+    frame.number = _frameNumber;
+    frame.start = now();
+    frame.duration = 0;
+  }
+
+  void Profiler::endFrame() {
+    if (!enabled()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    ProfileFrame &frame = _frames[_current];
+    mergeTotals(frame.totals);
+    frame.duration = now() - frame.start;
+    ++_frameNumber;
+    _current = (_current + 1) % frameHistory;
+    if (_completed < frameHistory) {
+      ++_completed;
+    }
+    // Clearing keeps the vectors' capacity, so once the ring has
+    // gone around once recording stops allocating
+    ProfileFrame &next = _frames[_current];
+    next.samples.clear();
+    next.counters.clear();
+    next.totals.clear();
+  }
+
+  void Profiler::record(const char *name, uint64_t start, uint64_t duration, uint32_t depth) {
+    uint32_t thread = currentThread();
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frames[_current].samples.push_back(ProfileSample{name, start, duration, thread, depth});
+    // Got the lock anyway
+    mergeTotals(_frames[_current].totals);
+  }
+
+  void Profiler::flushTotals() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    mergeTotals(_frames[_current].totals);
+  }
+
+  void Profiler::total(const char *name, uint64_t duration) {
+    if (ProfileTotal *total = findTotal(threadTotals, name)) {
+      total->calls++;
+      total->duration += duration;
+      total->max = std::max(total->max, duration);
+    } else {
+      threadTotals.push_back(ProfileTotal{name, 1, duration, duration});
+    }
+  }
+
+  void Profiler::count(const char *name, int64_t delta) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &counters = _frames[_current].counters;
+    for (auto &counter : counters) {
+      if (counter.name == name || strcmp(counter.name, name) == 0) {
+        counter.value += delta;
+        return;
+      }
+    }
+    counters.push_back(ProfileCounter{name, delta});
+  }
+
+  bool Profiler::lastFrame(ProfileFrame &frame) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_completed == 0) {
+      return false;
+    }
+    const ProfileFrame &last = _frames[(_current + frameHistory - 1) % frameHistory];
+    frame.number = last.number;
+    frame.start = last.start;
+    frame.duration = last.duration;
+    frame.samples.assign(last.samples.begin(), last.samples.end());
+    frame.counters.assign(last.counters.begin(), last.counters.end());
+    frame.totals.assign(last.totals.begin(), last.totals.end());
+    return true;
+  }
+
+  void Profiler::frameTimes(std::vector<float> &times) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    times.clear();
+    size_t first = (_current + frameHistory - _completed) % frameHistory;
+    for (size_t i = 0; i < _completed; ++i) {
+      times.push_back(_frames[(first + i) % frameHistory].duration / 1000000.0f);
+    }
+  }
+
+  void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto &frame : _frames) {
+      frame.samples.clear();
+      frame.counters.clear();
+      frame.totals.clear();
+    }
+    _completed = 0;
+  }
+
+  void Profiler::writeChromeTrace(std::ostream &out) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&]() {
+      if (!first) {
+        out << ",\n";
+      }
+      first = false;
+    };
+
+    size_t oldest = (_current + frameHistory - _completed) % frameHistory;
+    for (size_t i = 0; i < _completed; ++i) {
+      const ProfileFrame &frame = _frames[(oldest + i) % frameHistory];
+      // Frames get their own track so the scopes line up under them
+      separator();
+      out << std::format("{{\"name\":\"Frame {}\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":0}}",
+                         frame.number, micros(frame.start), micros(frame.duration));
+      for (const auto &sample : frame.samples) {
+        separator();
+        out << "{\"name\":\"";
+        writeEscaped(out, sample.name);
+        out << std::format("\",\"cat\":\"scope\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                           micros(sample.start), micros(sample.duration), sample.thread);
+      }
+      for (const auto &counter : frame.counters) {
+        separator();
+        out << "{\"name\":\"";
+        writeEscaped(out, counter.name);
+        out << std::format("\",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":1,\"args\":{{\"value\":{}}}}}",
+                           micros(frame.start), counter.value);
+      }
+      // Totals don't have a start time of their own, so they show as
+      // counters at the start of their frame
+      for (const auto &total : frame.totals) {
+        separator();
+        out << "{\"name\":\"";
+        writeEscaped(out, total.name);
+        out << std::format("\",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":1,\"args\":{{\"ms\":{:.3f},\"calls\":{}}}}}",
+                           micros(frame.start), total.duration / 1000000.0, total.calls);
+      }
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  }
+
+}
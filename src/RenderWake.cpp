@@ -0,0 +1,50 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fr/Imgui/RenderWake.h>
+
+namespace fr::Imgui {
+
+  RenderWake::RenderWake() : _requested(false) {
+  }
+
+  RenderWake &RenderWake::instance() {
+    static RenderWake wake;
+    return wake;
+  }
+
+  void RenderWake::setWaker(std::function<void()> waker) {
+    std::lock_guard<std::mutex> lock(_wakerMutex);
+    _waker = std::move(waker);
+  }
+
+  void RenderWake::request() {
+    // Only the first request since the loop last looked needs to
+    // wake it, the rest would just pile up events
+    if (_requested.exchange(true, std::memory_order_acq_rel)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_wakerMutex);
+    if (_waker) {
+      _waker();
+    }
+  }
+
+  bool RenderWake::consume() {
+    return _requested.exchange(false, std::memory_order_acq_rel);
+  }
+
+}
@@ -0,0 +1,667 @@
+/**
+ * Copyright 2026 Bruce Ide
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * GraphEditorBench drives a NodeEditorWindow without an SDL window or
+ * an OpenGL context. It loads graphs from GraphGenerator through
+ * WindowFactory, runs a fixed number of frames over each one and
+ * reports frame CPU time percentiles along with draw list and window
+ * counts. Nothing here needs a display, so it runs fine on headless
+ * CI boxes.
+ *
+ * Usage:
+ *   GraphEditorBench [--nodes 100,1000,10000,50000] [--frames 120] [--warmup 10]
+ *                    [--trace prefix] [--check-allocations] [--budgeted-load]
+ *                    [--zoom 1.0] [--check-reclaim 100] [--compare-formats 5]
+ *                    <generator flags>
+ *
+ * See GraphGeneratorOptions::parse for the generator flags.
+ *
+ * By default each graph is materialized all at once before the frames
+ * start. --budgeted-load runs frames while the editor materializes it
+ * a frame budget at a time and reports the worst frame of the load.
+ *
+ * --zoom measures the frames with the editor canvas zoomed to the
+ * given level, so the Box and Summary detail levels can be compared
+ * against Full.
+ *
+ * --trace turns the Profiler on and writes a Chrome trace of the last
+ * Profiler::frameHistory frames of each graph to prefix-<nodes>.json
+ *
+ * --check-allocations counts heap allocations made on the UI thread
+ * (operator new and ImGui's own allocator) during each measured frame.
+ * Once the editor has warmed up an idle frame shouldn't allocate
+ * anything, so the bench exits nonzero if any measured frame did.
+ * Don't combine it with --trace, the Profiler allocates while its
+ * ring buffer fills up.
+ *
+ * --check-reclaim loads the same graph (the first --nodes count) and
+ * closes it again the given number of times. Each one is linked to
+ * a small graph that stays open throughout, and generated graphs
+ * have change chains, so both kinds of link get cut. Then it checks
+ * that every node from the closed graphs was freed and that resident memory
+ * stayed flat once the first few cycles warmed things up. It exits
+ * nonzero if either check fails. The frame benchmark doesn't run in
+ * this mode.
+ *
+ * --compare-formats writes each generated graph out as JSON and as a
+ * binary .frg file in the temp directory, then reads each back the
+ * given number of times the way WindowFactory::loadGraph does (JSON
+ * through a buffer, binary through mmap). It reports the file sizes
+ * and the fastest read of each. The files are read from the page
+ * cache, so this is parse time more than disk time. It exits nonzero
+ * if the two formats don't read back the same number of nodes. The
+ * frame benchmark doesn't run in this mode either.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cereal/archives/json.hpp>
+#include <cereal/archives/portable_binary.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fr/Imgui/GraphFile.h>
+#include <fr/ImguiWidgets.h>
+#include <fr/Imgui/GraphGenerator.h>
+#include <fstream>
+#include <imgui.h>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace {
+
+  // Allocation counting. Only allocations made on the thread that
+  // runs the frames are counted, so the loader threads and anything
+  // else in the background don't trip the check.
+  std::atomic<bool> countAllocations{false};
+  std::atomic<size_t> allocationCount{0};
+  thread_local bool uiThread = false;
+
+  void noteAllocation() {
+    if (uiThread && countAllocations.load(std::memory_order_relaxed)) {
+      allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void *countedMalloc(size_t size) {
+    noteAllocation();
+    // malloc(0) is allowed to return null, operator new isn't
+    return std::malloc(size ? size : 1);
+  }
+
+  void *countedAlignedAlloc(size_t size, std::align_val_t align) {
+    noteAllocation();
+    size_t alignment = static_cast<size_t>(align);
+    // aligned_alloc wants the size to be a multiple of the alignment
+    size_t rounded = ((size ? size : 1) + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded);
+  }
+
+  void *imguiAlloc(size_t size, void *) {
+    return countedMalloc(size);
+  }
+
+  void imguiFree(void *ptr, void *) {
+    std::free(ptr);
+  }
+
+}
+
+void *operator new(size_t size) {
+  void *ptr = countedMalloc(size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return countedMalloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return countedMalloc(size);
+}
+
+void *operator new(size_t size, std::align_val_t align) {
+  void *ptr = countedAlignedAlloc(size, align);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size, std::align_val_t align) {
+  return operator new(size, align);
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+
+  struct BenchOptions {
+    std::vector<size_t> nodeCounts{100, 1000, 10000, 50000};
+    size_t frames = 120;
+    size_t warmupFrames = 10;
+    // Chrome trace file prefix, empty for no trace
+    std::string tracePrefix;
+    // Count allocations per frame and fail if an idle frame allocates
+    bool checkAllocations = false;
+    // Load through the editor's per-frame budget instead of all at once
+    bool budgetedLoad = false;
+    // Canvas zoom for the measured frames
+    float zoom = 1.0f;
+    // Load/close cycles for --check-reclaim, 0 to run the benchmark
+    size_t reclaimCycles = 0;
+    // Reads per format for --compare-formats, 0 to run the benchmark
+    size_t formatReads = 0;
+    // nodeCount gets set from nodeCounts for each graph
+    fr::Imgui::GraphGeneratorOptions generator;
+    // Size of the fake display the editor fills
+    ImVec2 displaySize{1920.0f, 1080.0f};
+  };
+
+  // One measured frame
+  struct FrameSample {
+    double cpuMs;
+    int vertices;
+    int indices;
+    int windows;
+    size_t allocations;
+  };
+
+  void usage(const char *name) {
+    std::cout << "Usage: " << name
+              << " [--nodes 100,1000,10000,50000] [--frames 120] [--warmup 10]"
+              << " [--trace prefix] [--check-allocations] [--budgeted-load] [--zoom 1.0]"
+              << " [--check-reclaim 100] [--compare-formats 5] "
+              << fr::Imgui::GraphGeneratorOptions::usage << std::endl;
+  }
+
+  std::vector<size_t> parseCounts(std::string_view text) {
+    std::vector<size_t> counts;
+    while (!text.empty()) {
+      auto comma = text.find(',');
+      auto item = text.substr(0, comma);
+      counts.push_back(std::strtoull(std::string(item).c_str(), nullptr, 10));
+      if (comma == std::string_view::npos) {
+        break;
+      }
+      text.remove_prefix(comma + 1);
+    }
+    return counts;
+  }
+
+  bool parseOptions(int argc, char **argv, BenchOptions &options) {
+    for (int i = 1; i < argc; ++i) {
+      std::string_view arg(argv[i]);
+      bool hasValue = (i + 1) < argc;
+      if (arg == "--nodes" && hasValue) {
+        options.nodeCounts = parseCounts(argv[++i]);
+      } else if (arg == "--frames" && hasValue) {
+        options.frames = std::strtoull(argv[++i], nullptr, 10);
+      } else if (arg == "--warmup" && hasValue) {
+        options.warmupFrames = std::strtoull(argv[++i], nullptr, 10);
+      } else if (arg == "--trace" && hasValue) {
+        options.tracePrefix = argv[++i];
+      } else if (arg == "--check-allocations") {
+        options.checkAllocations = true;
+      } else if (arg == "--budgeted-load") {
+        options.budgetedLoad = true;
+      } else if (arg == "--zoom" && hasValue) {
+        options.zoom = std::strtof(argv[++i], nullptr);
+      } else if (arg == "--check-reclaim" && hasValue) {
+        options.reclaimCycles = std::strtoull(argv[++i], nullptr, 10);
+      } else if (arg == "--compare-formats" && hasValue) {
+        options.formatReads = std::strtoull(argv[++i], nullptr, 10);
+      } else if (hasValue && options.generator.parse(arg, argv[i + 1])) {
+        ++i;
+      } else {
+        usage(argv[0]);
+        return false;
+      }
+    }
+    return !options.nodeCounts.empty() && options.frames > 0 && options.zoom > 0.0f;
+  }
+
+  // Sets up an ImGui context that never talks to a platform or
+  // renderer backend. The font atlas still has to be built before
+  // NewFrame will run.
+  void createContext(const BenchOptions &options) {
+    // ImGui goes straight to malloc unless it's told otherwise
+    ImGui::SetAllocatorFunctions(imguiAlloc, imguiFree);
+    ImGui::CreateContext();
+    ImGuiIO &io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = options.displaySize;
+    unsigned char *pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::StyleColorsDark();
+  }
+
+  template <typename Editor>
+  FrameSample runFrame(Editor &editor, const BenchOptions &options) {
+    ImGuiIO &io = ImGui::GetIO();
+    io.DisplaySize = options.displaySize;
+    io.DeltaTime = 1.0f / 60.0f;
+
+    fr::Imgui::Profiler::instance().beginFrame();
+    allocationCount.store(0, std::memory_order_relaxed);
+    countAllocations.store(options.checkAllocations, std::memory_order_relaxed);
+    auto start = Clock::now();
+    ImGui::NewFrame();
+    editor->begin();
+    editor->end();
+    ImGui::Render();
+    auto elapsed = Milliseconds(Clock::now() - start);
+    countAllocations.store(false, std::memory_order_relaxed);
+    fr::Imgui::Profiler::instance().endFrame();
+
+    ImDrawData *drawData = ImGui::GetDrawData();
+    FrameSample sample;
+    sample.cpuMs = elapsed.count();
+    sample.vertices = drawData ? drawData->TotalVtxCount : 0;
+    sample.indices = drawData ? drawData->TotalIdxCount : 0;
+    sample.windows = io.MetricsRenderWindows;
+    sample.allocations = allocationCount.load(std::memory_order_relaxed);
+    return sample;
+  }
+
+  // Nearest-rank percentile over an already sorted vector
+  double percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) {
+      return 0.0;
+    }
+    size_t rank = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+  }
+
+  // Returns the number of measured frames that allocated
+  size_t report(size_t nodeCount, double loadMs, const std::vector<FrameSample> &samples) {
+    std::vector<double> times;
+    times.reserve(samples.size());
+    size_t allocatingFrames = 0;
+    size_t maxAllocations = 0;
+    for (const auto &sample : samples) {
+      times.push_back(sample.cpuMs);
+      if (sample.allocations > 0) {
+        ++allocatingFrames;
+      }
+      maxAllocations = std::max(maxAllocations, sample.allocations);
+    }
+    std::sort(times.begin(), times.end());
+    const FrameSample &last = samples.back();
+    std::cout << std::format("{:>8} {:>10.2f} {:>9.3f} {:>9.3f} {:>9.3f} {:>9.3f} {:>10} {:>10} {:>8} {:>10}",
+                             nodeCount, loadMs,
+                             percentile(times, 50.0), percentile(times, 90.0),
+                             percentile(times, 99.0), times.back(),
+                             last.vertices, last.indices, last.windows, maxAllocations)
+              << std::endl;
+    return allocatingFrames;
+  }
+
+  // Returns false if the allocation check was on and failed
+  bool runGraph(size_t nodeCount, const BenchOptions &options) {
+    size_t allocatingFrames = 0;
+    createContext(options);
+    {
+      auto editor = std::make_shared<fr::Imgui::NodeEditorWindow<fr::Imgui::AllWindowList>>();
+      editor->buildMenus<fr::Imgui::AllWindowList>();
+      auto &factory = editor->factory();
+
+      auto generatorOptions = options.generator;
+      generatorOptions.nodeCount = nodeCount;
+      fr::Imgui::GraphGenerator<fr::Imgui::AllWindowList> generator(generatorOptions);
+      auto graph = generator.generate();
+      auto loadStart = Clock::now();
+      factory.add(graph);
+      if (options.budgetedLoad) {
+        // Let the editor bring the graph in a frame budget at a time
+        // and see how bad the worst frame gets
+        size_t loadFrames = 0;
+        double worstMs = 0.0;
+        while (factory.loading()) {
+          worstMs = std::max(worstMs, runFrame(editor, options).cpuMs);
+          ++loadFrames;
+        }
+        std::cout << std::format("{:>8} nodes loaded over {} frames, worst frame {:.3f} ms",
+                                 nodeCount, loadFrames, worstMs)
+                  << std::endl;
+      } else {
+        factory.materializeAll();
+      }
+      double loadMs = Milliseconds(Clock::now() - loadStart).count();
+
+      if (options.zoom != 1.0f) {
+        // Windows only get a canvas position once they've rendered,
+        // so give them a frame at full size before zooming
+        runFrame(editor, options);
+        editor->canvas().setZoom(options.zoom);
+      }
+
+      for (size_t i = 0; i < options.warmupFrames; ++i) {
+        runFrame(editor, options);
+      }
+      std::vector<FrameSample> samples;
+      samples.reserve(options.frames);
+      for (size_t i = 0; i < options.frames; ++i) {
+        samples.push_back(runFrame(editor, options));
+      }
+      allocatingFrames = report(nodeCount, loadMs, samples);
+
+      if (!options.tracePrefix.empty()) {
+        std::string path = std::format("{}-{}.json", options.tracePrefix, nodeCount);
+        std::ofstream out(path);
+        fr::Imgui::Profiler::instance().writeChromeTrace(out);
+        fr::Imgui::Profiler::instance().clear();
+      }
+    }
+    ImGui::DestroyContext();
+
+    if (options.checkAllocations && allocatingFrames > 0) {
+      std::cerr << std::format("{} nodes: {} of {} idle frames allocated",
+                               nodeCount, allocatingFrames, options.frames)
+                << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  // Resident set size in bytes, or 0 where we can't tell
+  size_t residentBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0;
+    size_t resident = 0;
+    if (statm >> pages >> resident) {
+      return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+  }
+
+  // Returns false if something from a closed graph was still alive or
+  // resident memory grew
+  bool runReclaimCheck(const BenchOptions &options) {
+    using Node = fr::RequirementsManager::Node;
+    const size_t nodeCount = options.nodeCounts.front();
+    // Allocator pools, ImGui's window list and so on fill up over
+    // the first few cycles. Measure growth from after that.
+    const size_t warmupCycles = std::max<size_t>(1, std::min<size_t>(10, options.reclaimCycles / 4));
+    // Room for allocator noise
+    const size_t slackBytes = 8 * 1024 * 1024;
+    size_t leakedNodes = 0;
+    size_t baseline = 0;
+    size_t resident = 0;
+    createContext(options);
+    {
+      auto editor = std::make_shared<fr::Imgui::NodeEditorWindow<fr::Imgui::AllWindowList>>();
+      editor->buildMenus<fr::Imgui::AllWindowList>();
+      auto &factory = editor->factory();
+
+      // Loading from the same JSON every time gives the same graph,
+      // UUIDs and all, like reopening a file would
+      std::string json;
+      {
+        auto generatorOptions = options.generator;
+        generatorOptions.nodeCount = nodeCount;
+        fr::Imgui::GraphGenerator<fr::Imgui::AllWindowList> generator(generatorOptions);
+        std::shared_ptr<Node> graph = generator.generate();
+        std::ostringstream out;
+        {
+          cereal::JSONOutputArchive archive(out);
+          archive(graph);
+        }
+        json = out.str();
+      }
+
+      // A graph that stays open the whole time. Each cycle's graph
+      // gets linked to it, so closing has to cut links from an open
+      // graph too.
+      std::shared_ptr<Node> kept;
+      {
+        auto generatorOptions = options.generator;
+        generatorOptions.nodeCount = 10;
+        generatorOptions.seed = options.generator.seed + 1;
+        fr::Imgui::GraphGenerator<fr::Imgui::AllWindowList> generator(generatorOptions);
+        kept = generator.generate();
+        factory.add(kept, "Kept");
+      }
+
+      for (size_t cycle = 0; cycle < options.reclaimCycles; ++cycle) {
+        std::vector<std::weak_ptr<Node>> nodes;
+        fr::Imgui::GraphId id;
+        {
+          std::shared_ptr<Node> graph;
+          std::istringstream in(json);
+          {
+            cereal::JSONInputArchive archive(in);
+            archive(graph);
+          }
+          graph->traverse([&](Node::PtrType node) { nodes.push_back(node); });
+          kept->addDown(graph);
+          graph->addUp(kept);
+          id = factory.add(graph);
+        }
+        factory.materializeAll();
+        runFrame(editor, options);
+        editor->closeGraph(id);
+        // The editor drops the windows when it applies the removes
+        runFrame(editor, options);
+        leakedNodes += std::count_if(nodes.begin(), nodes.end(),
+                                     [](const std::weak_ptr<Node> &node) { return !node.expired(); });
+        if (cycle + 1 == warmupCycles) {
+          baseline = residentBytes();
+        }
+      }
+      resident = residentBytes();
+    }
+    ImGui::DestroyContext();
+
+    std::cout << std::format("{} load/close cycles of {} nodes: {} nodes left alive, resident {:.1f} MiB "
+                             "after {} cycles, {:.1f} MiB at the end",
+                             options.reclaimCycles, nodeCount, leakedNodes,
+                             baseline / (1024.0 * 1024.0), warmupCycles, resident / (1024.0 * 1024.0))
+              << std::endl;
+    bool passed = true;
+    if (leakedNodes > 0) {
+      std::cerr << std::format("{} nodes from closed graphs were never freed", leakedNodes) << std::endl;
+      passed = false;
+    }
+    if (baseline > 0 && resident > baseline + std::max(baseline / 20, slackBytes)) {
+      std::cerr << std::format("Resident memory grew by {:.1f} MiB over {} cycles",
+                               (resident - baseline) / (1024.0 * 1024.0),
+                               options.reclaimCycles - warmupCycles)
+                << std::endl;
+      passed = false;
+    }
+    return passed;
+  }
+
+  // One format's numbers for --compare-formats
+  struct FormatSample {
+    std::uintmax_t bytes = 0;
+    double writeMs = 0.0;
+    double bestReadMs = 0.0;
+    size_t nodesRead = 0;
+  };
+
+  // Write graph to path in format, then read it back reads times
+  // through the same streambufs the editor loads with. Returns false
+  // if a write or read failed.
+  bool measureFormat(const std::shared_ptr<fr::RequirementsManager::Node> &graph, const std::string &path,
+                     fr::Imgui::GraphFormat format, size_t reads, FormatSample &sample) {
+    using Node = fr::RequirementsManager::Node;
+    using fr::Imgui::GraphFormat;
+    auto start = Clock::now();
+    {
+      std::ofstream out(path, format == GraphFormat::Binary ? std::ios::out | std::ios::binary : std::ios::out);
+      if (!out) {
+        std::cerr << "Could not open " << path << std::endl;
+        return false;
+      }
+      fr::Imgui::writeGraph(out, graph, format);
+    }
+    sample.writeMs = Milliseconds(Clock::now() - start).count();
+    sample.bytes = std::filesystem::file_size(path);
+
+    for (size_t read = 0; read < reads; ++read) {
+      fr::Imgui::GraphLoad load(path);
+      std::shared_ptr<Node> root;
+      auto readStart = Clock::now();
+      try {
+        if (format == GraphFormat::Binary) {
+          fr::Imgui::MappedGraphStreambuf buffer(path, &load);
+          std::istream in(&buffer);
+          root = fr::Imgui::readGraph(in, format);
+        } else {
+          fr::Imgui::GraphLoadStreambuf buffer(load);
+          std::istream in(&buffer);
+          root = fr::Imgui::readGraph(in, format);
+        }
+      } catch (const std::exception &e) {
+        std::cerr << std::format("Could not read {}: {}", path, e.what()) << std::endl;
+        return false;
+      }
+      double readMs = Milliseconds(Clock::now() - readStart).count();
+      if (read == 0 || readMs < sample.bestReadMs) {
+        sample.bestReadMs = readMs;
+      }
+      if (!root) {
+        std::cerr << "No graph in " << path << std::endl;
+        return false;
+      }
+      sample.nodesRead = 0;
+      root->traverse([&](Node::PtrType) { ++sample.nodesRead; });
+    }
+    return true;
+  }
+
+  // Returns false if either format failed or they disagreed about the
+  // graph
+  bool runFormatComparison(const BenchOptions &options) {
+    using fr::Imgui::GraphFormat;
+    std::cout << std::format("Fastest of {} reads per file", options.formatReads) << std::endl;
+    std::cout << std::format("{:>8} {:>7} {:>14} {:>10} {:>10} {:>10}",
+                             "nodes", "format", "bytes", "write ms", "read ms", "nodes read")
+              << std::endl;
+    auto directory = std::filesystem::temp_directory_path();
+    bool passed = true;
+    for (auto nodeCount : options.nodeCounts) {
+      auto generatorOptions = options.generator;
+      generatorOptions.nodeCount = nodeCount;
+      fr::Imgui::GraphGenerator<fr::Imgui::AllWindowList> generator(generatorOptions);
+      std::shared_ptr<fr::RequirementsManager::Node> graph = generator.generate();
+
+      std::string base = (directory / std::format("GraphEditorBench-{}", nodeCount)).string();
+      std::string jsonPath = base + std::string(fr::Imgui::jsonGraphExtension);
+      std::string binaryPath = base + std::string(fr::Imgui::binaryGraphExtension);
+      FormatSample json;
+      FormatSample binary;
+      bool measured = measureFormat(graph, jsonPath, GraphFormat::Json, options.formatReads, json) &&
+                      measureFormat(graph, binaryPath, GraphFormat::Binary, options.formatReads, binary);
+      std::error_code ignored;
+      std::filesystem::remove(jsonPath, ignored);
+      std::filesystem::remove(binaryPath, ignored);
+      if (!measured) {
+        passed = false;
+        continue;
+      }
+
+      for (const auto &[name, sample] : {std::pair{"json", json}, std::pair{"frg", binary}}) {
+        std::cout << std::format("{:>8} {:>7} {:>14} {:>10.2f} {:>10.2f} {:>10}",
+                                 nodeCount, name, sample.bytes, sample.writeMs, sample.bestReadMs,
+                                 sample.nodesRead)
+                  << std::endl;
+      }
+      if (binary.bytes > 0 && binary.bestReadMs > 0.0) {
+        std::cout << std::format("{:>8} binary is {:.2f}x smaller and reads {:.2f}x faster",
+                                 "", static_cast<double>(json.bytes) / static_cast<double>(binary.bytes),
+                                 json.bestReadMs / binary.bestReadMs)
+                  << std::endl;
+      }
+      if (json.nodesRead != binary.nodesRead) {
+        std::cerr << std::format("JSON read back {} nodes but binary read back {}",
+                                 json.nodesRead, binary.nodesRead)
+                  << std::endl;
+        passed = false;
+      }
+    }
+    return passed;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  BenchOptions options;
+  if (!parseOptions(argc, argv, options)) {
+    return 1;
+  }
+  if (!options.tracePrefix.empty()) {
+    fr::Imgui::Profiler::instance().setEnabled(true);
+  }
+  uiThread = true;
+
+  if (options.reclaimCycles > 0) {
+    return runReclaimCheck(options) ? 0 : 1;
+  }
+  if (options.formatReads > 0) {
+    return runFormatComparison(options) ? 0 : 1;
+  }
+
+  std::cout << std::format("{} frames per graph after {} warmup frames, display {}x{}",
+                           options.frames, options.warmupFrames,
+                           options.displaySize.x, options.displaySize.y)
+            << std::endl;
+  std::cout << std::format("{:>8} {:>10} {:>9} {:>9} {:>9} {:>9} {:>10} {:>10} {:>8} {:>10}",
+                           "nodes", "load ms", "p50 ms", "p90 ms", "p99 ms", "max ms",
+                           "vertices", "indices", "windows", "max allocs")
+            << std::endl;
+
+  bool passed = true;
+  for (auto nodeCount : options.nodeCounts) {
+    passed = runGraph(nodeCount, options) && passed;
+  }
+  return passed ? 0 : 1;
+}
@@ -13,7 +13,10 @@
 #include "imgui_impl_opengl3.h"
 #include "imgui_impl_sdl3.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
 #include <fr/ImguiWidgets.h>
+#include <fr/Imgui/IniSettings.h>
+#include <fr/Imgui/RenderWake.h>
 #include <stdio.h>
 #if defined(IMGUI_IMPL_OPENGL_ES2)
 #include <SDL3/SDL_opengles2.h>
@@ -114,6 +117,14 @@ int main(int, char **) {
   io.ConfigFlags |=
       ImGuiConfigFlags_NavEnableGamepad; // Enable Gamepad Controls
 
+  // imgui.ini goes through IniSettings so stale node windows get
+  // pruned. ImGui just sets WantSaveIniSettings when it's time.
+  [[maybe_unused]] const char *iniFilename = "imgui.ini";
+  io.IniFilename = nullptr;
+#ifndef __EMSCRIPTEN__
+  fr::Imgui::IniSettings::instance().load(iniFilename);
+#endif
+
   // Setup Dear ImGui style
   ImGui::StyleColorsDark();
   // ImGui::StyleColorsLight();
@@ -175,11 +186,41 @@ int main(int, char **) {
   // when user goes file->exit
   FRDemoWindow->exitEvent.connect([&done]() { done = true; });
 
+  auto handleEvent = [&](const SDL_Event &event) {
+    ImGui_ImplSDL3_ProcessEvent(&event);
+    if (event.type == SDL_EVENT_QUIT)
+      done = true;
+    if (event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED &&
+        event.window.windowID == SDL_GetWindowID(window))
+      done = true;
+  };
+
+  // Idle mode. When nothing is going on the loop sleeps in
+  // SDL_WaitEventTimeout instead of drawing every vsync. Input, a
+  // RenderWake request (factories queueing nodes, REST results) or a
+  // graph that's still loading keep it drawing. Each of those buys
+  // trailingFrames more frames so ImGui can settle hover highlights,
+  // resizes and so on before the loop goes back to sleep.
+  const int trailingFrames = 3;
+  // Draw a frame at least this often while idle, in case something
+  // changed without asking for one
+  const Sint32 idleTimeoutMs = 1000;
+  int framesToRender = trailingFrames;
+  // Other threads wake the loop by pushing one of these
+  Uint32 wakeEvent = SDL_RegisterEvents(1);
+  bool idleMode = wakeEvent != 0;
+  if (idleMode) {
+    fr::Imgui::RenderWake::instance().setWaker([wakeEvent]() {
+      SDL_Event event;
+      SDL_zero(event);
+      event.type = wakeEvent;
+      SDL_PushEvent(&event);
+    });
+  }
+
 #ifdef __EMSCRIPTEN__
-  // For an Emscripten build we are disabling file-system access, so let's not
-  // attempt to do a fopen() of the imgui.ini file. You may manually call
-  // LoadIniSettingsFromMemory() to load settings from your own storage.
-  io.IniFilename = nullptr;
+  // For an Emscripten build we are disabling file-system access, so
+  // IniSettings never loads or saves imgui.ini there.
   EMSCRIPTEN_MAINLOOP_BEGIN
 #else
   while (!done)
@@ -197,13 +238,24 @@ int main(int, char **) {
     // SDL_MAIN_USE_CALLBACKS: call ImGui_ImplSDL3_ProcessEvent() from your
     // SDL_AppEvent() function]
     SDL_Event event;
+#ifndef __EMSCRIPTEN__
+    if (idleMode && framesToRender == 0 && !FRDemoWindow->loading()) {
+      // Nothing to draw. Sleep until there's input or a wake request,
+      // or draw a single frame if the timeout runs out first.
+      if (SDL_WaitEventTimeout(&event, idleTimeoutMs)) {
+        handleEvent(event);
+        framesToRender = trailingFrames;
+      } else {
+        framesToRender = 1;
+      }
+    }
+#endif
     while (SDL_PollEvent(&event)) {
-      ImGui_ImplSDL3_ProcessEvent(&event);
-      if (event.type == SDL_EVENT_QUIT)
-        done = true;
-      if (event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED &&
-          event.window.windowID == SDL_GetWindowID(window))
-        done = true;
+      handleEvent(event);
+      framesToRender = trailingFrames;
+    }
+    if (fr::Imgui::RenderWake::instance().consume()) {
+      framesToRender = trailingFrames;
     }
 
     // [If using SDL_MAIN_USE_CALLBACKS: all code below would likely be your
@@ -215,6 +267,8 @@ int main(int, char **) {
 
     auto clear_color = FRDemoWindow->getBackgroundColor();
 
+    fr::Imgui::Profiler::instance().beginFrame();
+
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplSDL3_NewFrame();
@@ -231,6 +285,24 @@ int main(int, char **) {
     glClear(GL_COLOR_BUFFER_BIT);
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     SDL_GL_SwapWindow(window);
+
+    fr::Imgui::Profiler::instance().endFrame();
+
+#ifndef __EMSCRIPTEN__
+    if (io.WantSaveIniSettings) {
+      fr::Imgui::IniSettings::instance().save(iniFilename);
+      io.WantSaveIniSettings = false;
+    }
+#endif
+
+    if (framesToRender > 0) {
+      --framesToRender;
+    }
+    // Keep drawing while something is being dragged or typed in.
+    // Held buttons and the text cursor don't generate events.
+    if (ImGui::IsAnyItemActive()) {
+      framesToRender = std::max(framesToRender, 1);
+    }
   }
 #ifdef __EMSCRIPTEN__
   EMSCRIPTEN_MAINLOOP_END;
@@ -239,6 +311,9 @@ int main(int, char **) {
   // Cleanup
   // [If using SDL_MAIN_USE_CALLBACKS: all code below would likely be your
   // SDL_AppQuit() function]
+#ifndef __EMSCRIPTEN__
+  fr::Imgui::IniSettings::instance().save(iniFilename);
+#endif
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplSDL3_Shutdown();
   ImGui::DestroyContext();